@@ -0,0 +1,771 @@
+// dear imgui: Renderer Backend for CPU software rasterization
+// This rasterizes ImDrawData into a 32-bit color buffer in memory. No GPU or graphics API involved.
+// This is designed for headless rendering: golden-image tests, screenshots and thumbnails, remote displays.
+// Output only depends on ImDrawData contents, not on the number of threads used.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Image*' as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Packed 16-bit indices and draw data arenas (ImGuiBackendFlags_RendererHasIdxSize, ImDrawData::ArenaVtxBuffer).
+//  [X] Renderer: Multi-threaded rasterization using platform_io.Platform_ParallelForFn when set.
+//  [X] Renderer: Redraw only changed tiles with ImGui_ImplSoftRaster_RenderDrawDataTiles() + ImDrawDataTileTracker.
+//  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// CHANGELOG
+// (minor and older changes stripped away, please see git history for details)
+//  2026-10-17: Added ImGui_ImplSoftRaster_RenderDrawDataTiles() to redraw tiles reported by ImDrawDataTileTracker.
+//  2026-10-17: Initial version.
+
+// Rasterization rules (matching what GPU backends produce, within 1/255 rounding):
+// - Vertices are snapped to 1/16th of a pixel. Pixels are sampled at their center, shared edges use a top-left fill rule so no pixel is drawn twice.
+// - Colors and UV are interpolated linearly in screen space (ImDrawData has no perspective). Textures are sampled bilinearly with clamp-to-edge.
+// - Blending is non-premultiplied: RGB = src * src_a + dst * (1 - src_a), A = src_a + dst_a * (1 - src_a), as our OpenGL/DX backends setup.
+// - Scissor rectangles are converted to pixels by truncation, as our other backends do.
+// Implementation:
+// - Triangles are walked in 8x8 pixel tiles. Tiles fully outside an edge are rejected, and edges fully covering a tile are skipped.
+//   Only the remaining edges are evaluated per pixel, 8 pixels at a time with SSE2 when available.
+// - The target is split in horizontal bands which may be processed in parallel. Each band processes every triangle in submission
+//   order and only writes its own rows, so the output is identical with any number of threads.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_softraster.h"
+#include <math.h>           // floorf
+#include <stdint.h>         // intptr_t
+#include <string.h>         // memcpy, memset
+
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_IMPL_SOFTRASTER_SSE2
+#include <emmintrin.h>
+#endif
+
+// Clang/GCC warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wold-style-cast"         // warning: use of old-style cast                            // yes, they are more terse.
+#pragma clang diagnostic ignored "-Wsign-conversion"        // warning: implicit conversion changes signedness
+#pragma clang diagnostic ignored "-Wcast-align"             // warning: cast from 'char *' to 'ImU32 *' increases required alignment
+#endif
+
+// Rows per band. Smaller bands balance better across threads, larger bands reduce per-band triangle setup.
+static const int    ImGui_ImplSoftRaster_BandHeight = 64;
+// Vertex positions are clamped to this range (in pixels) so edge functions of crossing edges fit in 32-bit within a tile.
+static const float  ImGui_ImplSoftRaster_MaxCoord = 262144.0f;
+
+// Software Renderer data
+struct ImGui_ImplSoftRaster_Data
+{
+    int                 BandHeight;
+    ImVector<int>       DirtySpans;     // 3 values per row of tiles with dirty tiles: tile_y, first tile_x, last tile_x
+
+    ImGui_ImplSoftRaster_Data()     { memset((void*)this, 0, sizeof(*this)); }
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplSoftRaster_Data* ImGui_ImplSoftRaster_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplSoftRaster_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+// Functions
+bool ImGui_ImplSoftRaster_Init()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplSoftRaster_Data* bd = IM_NEW(ImGui_ImplSoftRaster_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_softraster";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;   // We can honor ImGuiPlatformIO::Textures[] requests during render.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasIdxSize;    // We can honor ImDrawData::IdxSize, allowing for packed 16-bit indices.
+
+    bd->BandHeight = ImGui_ImplSoftRaster_BandHeight;
+
+    return true;
+}
+
+void ImGui_ImplSoftRaster_Shutdown()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+
+    ImGui_ImplSoftRaster_DestroyDeviceObjects();
+
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasIdxSize);
+    platform_io.ClearRendererHandlers();
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplSoftRaster_NewFrame()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoftRaster_Init()?");
+    IM_UNUSED(bd);
+}
+
+//-----------------------------------------------------------------------------
+// Pixel operations
+//-----------------------------------------------------------------------------
+
+static inline int ImGui_ImplSoftRaster_Min(int a, int b) { return a < b ? a : b; }
+static inline int ImGui_ImplSoftRaster_Max(int a, int b) { return a > b ? a : b; }
+
+// Exact rounding of x / 255 for x in [0, 255*255*2]
+static inline int ImGui_ImplSoftRaster_Div255(int x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+static inline int ImGui_ImplSoftRaster_Channel(ImU32 col, int shift)
+{
+    return (int)((col >> shift) & 0xFF);
+}
+
+static inline int ImGui_ImplSoftRaster_ClampChannel(float v)
+{
+    int i = (int)(v + 0.5f);
+    return i < 0 ? 0 : i > 255 ? 255 : i;
+}
+
+static inline ImU32 ImGui_ImplSoftRaster_FetchTexel(const ImGui_ImplSoftRaster_Image* tex, int x, int y)
+{
+    return ((const ImU32*)(const void*)((const char*)tex->Pixels + (size_t)y * tex->Pitch))[x];
+}
+
+// Bilinear filtering with clamp-to-edge, 8-bit weights. Output as R,G,B,A in [0,255]
+static void ImGui_ImplSoftRaster_SampleBilinear(const ImGui_ImplSoftRaster_Image* tex, float u, float v, int out_rgba[4])
+{
+    if (tex == nullptr)
+    {
+        out_rgba[0] = out_rgba[1] = out_rgba[2] = out_rgba[3] = 255;
+        return;
+    }
+    float fx = u * (float)tex->Width - 0.5f;
+    float fy = v * (float)tex->Height - 0.5f;
+    fx = (fx > -1.0f) ? (fx < (float)tex->Width ? fx : (float)tex->Width) : -1.0f; // Also catches NaN
+    fy = (fy > -1.0f) ? (fy < (float)tex->Height ? fy : (float)tex->Height) : -1.0f;
+    const float flx = floorf(fx);
+    const float fly = floorf(fy);
+    int wx = (int)((fx - flx) * 256.0f);
+    int wy = (int)((fy - fly) * 256.0f);
+    wx = wx > 256 ? 256 : wx;
+    wy = wy > 256 ? 256 : wy;
+    int x0 = (int)flx, y0 = (int)fly;
+    int x1 = x0 + 1, y1 = y0 + 1;
+    x0 = x0 < 0 ? 0 : x0 >= tex->Width ? tex->Width - 1 : x0;
+    x1 = x1 < 0 ? 0 : x1 >= tex->Width ? tex->Width - 1 : x1;
+    y0 = y0 < 0 ? 0 : y0 >= tex->Height ? tex->Height - 1 : y0;
+    y1 = y1 < 0 ? 0 : y1 >= tex->Height ? tex->Height - 1 : y1;
+    const ImU32 c00 = ImGui_ImplSoftRaster_FetchTexel(tex, x0, y0);
+    const ImU32 c10 = ImGui_ImplSoftRaster_FetchTexel(tex, x1, y0);
+    const ImU32 c01 = ImGui_ImplSoftRaster_FetchTexel(tex, x0, y1);
+    const ImU32 c11 = ImGui_ImplSoftRaster_FetchTexel(tex, x1, y1);
+    if (c00 == c10 && c00 == c01 && c00 == c11)
+    {
+        out_rgba[0] = ImGui_ImplSoftRaster_Channel(c00, IM_COL32_R_SHIFT);
+        out_rgba[1] = ImGui_ImplSoftRaster_Channel(c00, IM_COL32_G_SHIFT);
+        out_rgba[2] = ImGui_ImplSoftRaster_Channel(c00, IM_COL32_B_SHIFT);
+        out_rgba[3] = ImGui_ImplSoftRaster_Channel(c00, IM_COL32_A_SHIFT);
+        return;
+    }
+    static const int shifts[4] = { IM_COL32_R_SHIFT, IM_COL32_G_SHIFT, IM_COL32_B_SHIFT, IM_COL32_A_SHIFT };
+    for (int c = 0; c < 4; c++)
+    {
+        const int top = ImGui_ImplSoftRaster_Channel(c00, shifts[c]) * (256 - wx) + ImGui_ImplSoftRaster_Channel(c10, shifts[c]) * wx;
+        const int bottom = ImGui_ImplSoftRaster_Channel(c01, shifts[c]) * (256 - wx) + ImGui_ImplSoftRaster_Channel(c11, shifts[c]) * wx;
+        out_rgba[c] = (top * (256 - wy) + bottom * wy + 32768) >> 16;
+    }
+}
+
+static inline void ImGui_ImplSoftRaster_BlendPixel(ImU32* dst, int r, int g, int b, int a)
+{
+    if (a == 0)
+        return;
+    if (a == 255)
+    {
+        *dst = IM_COL32(r, g, b, 255);
+        return;
+    }
+    const ImU32 d = *dst;
+    const int ia = 255 - a;
+    const int out_r = ImGui_ImplSoftRaster_Div255(r * a + ImGui_ImplSoftRaster_Channel(d, IM_COL32_R_SHIFT) * ia);
+    const int out_g = ImGui_ImplSoftRaster_Div255(g * a + ImGui_ImplSoftRaster_Channel(d, IM_COL32_G_SHIFT) * ia);
+    const int out_b = ImGui_ImplSoftRaster_Div255(b * a + ImGui_ImplSoftRaster_Channel(d, IM_COL32_B_SHIFT) * ia);
+    const int out_a = a + ImGui_ImplSoftRaster_Div255(ImGui_ImplSoftRaster_Channel(d, IM_COL32_A_SHIFT) * ia);
+    *dst = IM_COL32(out_r, out_g, out_b, out_a);
+}
+
+//-----------------------------------------------------------------------------
+// Triangle rasterization
+//-----------------------------------------------------------------------------
+
+enum ImGui_ImplSoftRaster_Attr
+{
+    ImGui_ImplSoftRaster_Attr_R,
+    ImGui_ImplSoftRaster_Attr_G,
+    ImGui_ImplSoftRaster_Attr_B,
+    ImGui_ImplSoftRaster_Attr_A,
+    ImGui_ImplSoftRaster_Attr_U,
+    ImGui_ImplSoftRaster_Attr_V,
+    ImGui_ImplSoftRaster_Attr_COUNT
+};
+
+struct ImGui_ImplSoftRaster_Triangle
+{
+    // Coverage: E(x,y) = StepX * x + StepY * y + Origin, pixel covered when >= 0 for all 3 edges (top-left rule bias is folded in Origin)
+    int                                 EdgeStepX[3];
+    int                                 EdgeStepY[3];
+    ImS64                               EdgeOrigin[3];
+    int                                 MinX, MinY, MaxX, MaxY;     // Inclusive pixel bounds, already clipped
+
+    // Shading
+    const ImGui_ImplSoftRaster_Image*   Tex;
+    bool                                ConstColor;                 // All vertices share same color
+    bool                                ConstUV;                    // All vertices share same UV: texel sampled once
+    int                                 Src[4];                     // When ConstColor && ConstUV: final color. When ConstColor: vertex color. When ConstUV: texel.
+    float                               BaseX, BaseY;               // Position of vertex 0, in pixels
+    float                               Attr[ImGui_ImplSoftRaster_Attr_COUNT];
+    float                               AttrDx[ImGui_ImplSoftRaster_Attr_COUNT];
+    float                               AttrDy[ImGui_ImplSoftRaster_Attr_COUNT];
+};
+
+// Shade pixels of a row within a tile. Bit n of 'mask' set for pixel (x + n, y).
+static void ImGui_ImplSoftRaster_ShadeTileRow(const ImGui_ImplSoftRaster_Triangle& tri, ImU32* row, int x, int y, unsigned int mask)
+{
+    if (tri.ConstColor && tri.ConstUV)
+    {
+        for (; mask != 0; mask >>= 1, x++)
+            if (mask & 1)
+                ImGui_ImplSoftRaster_BlendPixel(&row[x], tri.Src[0], tri.Src[1], tri.Src[2], tri.Src[3]);
+        return;
+    }
+
+    const float py = (float)y + 0.5f - tri.BaseY;
+    for (; mask != 0; mask >>= 1, x++)
+    {
+        if ((mask & 1) == 0)
+            continue;
+        const float px = (float)x + 0.5f - tri.BaseX;
+        int texel[4];
+        int col[4];
+        if (tri.ConstUV)
+            memcpy(texel, tri.Src, sizeof(texel));
+        else
+            ImGui_ImplSoftRaster_SampleBilinear(tri.Tex,
+                tri.Attr[ImGui_ImplSoftRaster_Attr_U] + tri.AttrDx[ImGui_ImplSoftRaster_Attr_U] * px + tri.AttrDy[ImGui_ImplSoftRaster_Attr_U] * py,
+                tri.Attr[ImGui_ImplSoftRaster_Attr_V] + tri.AttrDx[ImGui_ImplSoftRaster_Attr_V] * px + tri.AttrDy[ImGui_ImplSoftRaster_Attr_V] * py, texel);
+        if (tri.ConstColor && !tri.ConstUV)
+            memcpy(col, tri.Src, sizeof(col));
+        else
+            for (int c = 0; c < 4; c++)
+                col[c] = ImGui_ImplSoftRaster_ClampChannel(tri.Attr[c] + tri.AttrDx[c] * px + tri.AttrDy[c] * py);
+        ImGui_ImplSoftRaster_BlendPixel(&row[x],
+            ImGui_ImplSoftRaster_Div255(texel[0] * col[0]), ImGui_ImplSoftRaster_Div255(texel[1] * col[1]),
+            ImGui_ImplSoftRaster_Div255(texel[2] * col[2]), ImGui_ImplSoftRaster_Div255(texel[3] * col[3]));
+    }
+}
+
+// Walk 8x8 tiles overlapping the triangle bounds.
+static void ImGui_ImplSoftRaster_WalkTiles(const ImGui_ImplSoftRaster_Triangle& tri, ImGui_ImplSoftRaster_Image* target)
+{
+#ifdef IMGUI_IMPL_SOFTRASTER_SSE2
+    __m128i step_lo[3], step_hi[3];
+    for (int e = 0; e < 3; e++)
+    {
+        step_lo[e] = _mm_setr_epi32(0, tri.EdgeStepX[e], tri.EdgeStepX[e] * 2, tri.EdgeStepX[e] * 3);
+        step_hi[e] = _mm_add_epi32(step_lo[e], _mm_set1_epi32(tri.EdgeStepX[e] * 4));
+    }
+#endif
+
+    for (int tile_y = tri.MinY & ~7; tile_y <= tri.MaxY; tile_y += 8)
+    {
+        const int y0 = (tile_y > tri.MinY) ? tile_y : tri.MinY;
+        const int y1 = (tile_y + 7 < tri.MaxY) ? tile_y + 7 : tri.MaxY;
+        for (int tile_x = tri.MinX & ~7; tile_x <= tri.MaxX; tile_x += 8)
+        {
+            const int x0 = (tile_x > tri.MinX) ? tile_x : tri.MinX;
+            const int x1 = (tile_x + 7 < tri.MaxX) ? tile_x + 7 : tri.MaxX;
+            const unsigned int cols_mask = ((0xFFu << (x0 - tile_x)) & (0xFFu >> (7 - (x1 - tile_x))));
+
+            // Classify edges against the whole tile: edge functions are linear so extremes are at corners.
+            int crossing_edges[3];
+            int crossing_values[3];
+            int crossing_count = 0;
+            bool rejected = false;
+            for (int e = 0; e < 3 && !rejected; e++)
+            {
+                const ImS64 e00 = (ImS64)tri.EdgeStepX[e] * tile_x + (ImS64)tri.EdgeStepY[e] * tile_y + tri.EdgeOrigin[e];
+                const ImS64 dx = (ImS64)tri.EdgeStepX[e] * 7;
+                const ImS64 dy = (ImS64)tri.EdgeStepY[e] * 7;
+                const ImS64 e_min = e00 + (dx < 0 ? dx : 0) + (dy < 0 ? dy : 0);
+                const ImS64 e_max = e00 + (dx > 0 ? dx : 0) + (dy > 0 ? dy : 0);
+                if (e_max < 0)
+                    rejected = true;
+                else if (e_min < 0)
+                {
+                    crossing_edges[crossing_count] = e;
+                    crossing_values[crossing_count++] = (int)e00; // Bounded by |e_max - e_min| for a crossing edge.
+                }
+            }
+            if (rejected)
+                continue;
+
+            for (int y = y0; y <= y1; y++)
+            {
+                ImU32* row = (ImU32*)(void*)((char*)target->Pixels + (size_t)y * target->Pitch);
+                unsigned int mask = cols_mask;
+                if (crossing_count > 0)
+                {
+                    const int row_offset = y - tile_y;
+#ifdef IMGUI_IMPL_SOFTRASTER_SSE2
+                    __m128i lo = _mm_setzero_si128();
+                    __m128i hi = _mm_setzero_si128();
+                    for (int n = 0; n < crossing_count; n++)
+                    {
+                        const int e = crossing_edges[n];
+                        const __m128i row_value = _mm_set1_epi32(crossing_values[n] + tri.EdgeStepY[e] * row_offset);
+                        lo = _mm_or_si128(lo, _mm_add_epi32(row_value, step_lo[e]));
+                        hi = _mm_or_si128(hi, _mm_add_epi32(row_value, step_hi[e]));
+                    }
+                    const unsigned int outside = (unsigned int)(_mm_movemask_ps(_mm_castsi128_ps(lo)) | (_mm_movemask_ps(_mm_castsi128_ps(hi)) << 4));
+                    mask &= ~outside;
+#else
+                    for (int n = 0; n < crossing_count; n++)
+                    {
+                        const int e = crossing_edges[n];
+                        const int row_value = crossing_values[n] + tri.EdgeStepY[e] * row_offset;
+                        for (int i = 0; i < 8; i++)
+                            if (row_value + tri.EdgeStepX[e] * i < 0)
+                                mask &= ~(1u << i);
+                    }
+#endif
+                }
+                if (mask != 0)
+                    ImGui_ImplSoftRaster_ShadeTileRow(tri, row, tile_x, y, mask);
+            }
+        }
+    }
+}
+
+// Setup and rasterize one triangle, clipped to [clip_x0,clip_x1) x [clip_y0,clip_y1)
+static void ImGui_ImplSoftRaster_RasterTriangle(ImGui_ImplSoftRaster_Image* target, const ImDrawVert* v0, const ImDrawVert* v1, const ImDrawVert* v2, const ImGui_ImplSoftRaster_Image* tex, const ImVec2& pos_off, const ImVec2& pos_scale, int clip_x0, int clip_y0, int clip_x1, int clip_y1)
+{
+    const ImDrawVert* v[3] = { v0, v1, v2 };
+    float xf[3], yf[3];
+    for (int i = 0; i < 3; i++)
+    {
+        xf[i] = (v[i]->pos.x - pos_off.x) * pos_scale.x;
+        yf[i] = (v[i]->pos.y - pos_off.y) * pos_scale.y;
+    }
+
+    // Cheap reject against clip rectangle (most triangles are outside of a band)
+    if ((yf[0] >= (float)clip_y1 && yf[1] >= (float)clip_y1 && yf[2] >= (float)clip_y1) || (yf[0] < (float)clip_y0 && yf[1] < (float)clip_y0 && yf[2] < (float)clip_y0))
+        return;
+    if ((xf[0] >= (float)clip_x1 && xf[1] >= (float)clip_x1 && xf[2] >= (float)clip_x1) || (xf[0] < (float)clip_x0 && xf[1] < (float)clip_x0 && xf[2] < (float)clip_x0))
+        return;
+
+    // Snap to 28.4 fixed point
+    int fx[3], fy[3];
+    for (int i = 0; i < 3; i++)
+    {
+        const float x = (xf[i] > -ImGui_ImplSoftRaster_MaxCoord) ? (xf[i] < ImGui_ImplSoftRaster_MaxCoord ? xf[i] : ImGui_ImplSoftRaster_MaxCoord) : -ImGui_ImplSoftRaster_MaxCoord;
+        const float y = (yf[i] > -ImGui_ImplSoftRaster_MaxCoord) ? (yf[i] < ImGui_ImplSoftRaster_MaxCoord ? yf[i] : ImGui_ImplSoftRaster_MaxCoord) : -ImGui_ImplSoftRaster_MaxCoord;
+        fx[i] = (int)floorf(x * 16.0f + 0.5f);
+        fy[i] = (int)floorf(y * 16.0f + 0.5f);
+    }
+
+    // Ensure positive area, ImGui emits both windings
+    ImS64 area = (ImS64)(fx[1] - fx[0]) * (fy[2] - fy[0]) - (ImS64)(fy[1] - fy[0]) * (fx[2] - fx[0]);
+    if (area == 0)
+        return;
+    if (area < 0)
+    {
+        const ImDrawVert* tmp_v = v[1]; v[1] = v[2]; v[2] = tmp_v;
+        int tmp = fx[1]; fx[1] = fx[2]; fx[2] = tmp;
+        tmp = fy[1]; fy[1] = fy[2]; fy[2] = tmp;
+        area = -area;
+    }
+
+    // Pixel bounds: pixel n is sampled at (n * 16 + 8) in fixed point
+    ImGui_ImplSoftRaster_Triangle tri;
+    const int min_fx = ImGui_ImplSoftRaster_Min(fx[0], ImGui_ImplSoftRaster_Min(fx[1], fx[2]));
+    const int min_fy = ImGui_ImplSoftRaster_Min(fy[0], ImGui_ImplSoftRaster_Min(fy[1], fy[2]));
+    const int max_fx = ImGui_ImplSoftRaster_Max(fx[0], ImGui_ImplSoftRaster_Max(fx[1], fx[2]));
+    const int max_fy = ImGui_ImplSoftRaster_Max(fy[0], ImGui_ImplSoftRaster_Max(fy[1], fy[2]));
+    tri.MinX = ImGui_ImplSoftRaster_Max((min_fx + 7) >> 4, clip_x0);
+    tri.MinY = ImGui_ImplSoftRaster_Max((min_fy + 7) >> 4, clip_y0);
+    tri.MaxX = ImGui_ImplSoftRaster_Min((max_fx - 8) >> 4, clip_x1 - 1);
+    tri.MaxY = ImGui_ImplSoftRaster_Min((max_fy - 8) >> 4, clip_y1 - 1);
+    if (tri.MinX > tri.MaxX || tri.MinY > tri.MaxY)
+        return;
+
+    // Shading setup
+    tri.Tex = tex;
+    tri.ConstColor = (v[0]->col == v[1]->col && v[0]->col == v[2]->col);
+    tri.ConstUV = (v[0]->uv.x == v[1]->uv.x && v[0]->uv.x == v[2]->uv.x && v[0]->uv.y == v[1]->uv.y && v[0]->uv.y == v[2]->uv.y);
+    if (tri.ConstColor && ImGui_ImplSoftRaster_Channel(v[0]->col, IM_COL32_A_SHIFT) == 0)
+        return;
+    if (tri.ConstUV)
+        ImGui_ImplSoftRaster_SampleBilinear(tex, v[0]->uv.x, v[0]->uv.y, tri.Src);
+    if (tri.ConstColor)
+    {
+        const ImU32 col = v[0]->col;
+        const int col_rgba[4] = { ImGui_ImplSoftRaster_Channel(col, IM_COL32_R_SHIFT), ImGui_ImplSoftRaster_Channel(col, IM_COL32_G_SHIFT), ImGui_ImplSoftRaster_Channel(col, IM_COL32_B_SHIFT), ImGui_ImplSoftRaster_Channel(col, IM_COL32_A_SHIFT) };
+        for (int c = 0; c < 4; c++)
+            tri.Src[c] = tri.ConstUV ? ImGui_ImplSoftRaster_Div255(tri.Src[c] * col_rgba[c]) : col_rgba[c];
+    }
+    if (!tri.ConstColor || !tri.ConstUV)
+    {
+        // Plane equations for attributes, from snapped positions
+        float attr[3][ImGui_ImplSoftRaster_Attr_COUNT];
+        for (int i = 0; i < 3; i++)
+        {
+            attr[i][ImGui_ImplSoftRaster_Attr_R] = (float)ImGui_ImplSoftRaster_Channel(v[i]->col, IM_COL32_R_SHIFT);
+            attr[i][ImGui_ImplSoftRaster_Attr_G] = (float)ImGui_ImplSoftRaster_Channel(v[i]->col, IM_COL32_G_SHIFT);
+            attr[i][ImGui_ImplSoftRaster_Attr_B] = (float)ImGui_ImplSoftRaster_Channel(v[i]->col, IM_COL32_B_SHIFT);
+            attr[i][ImGui_ImplSoftRaster_Attr_A] = (float)ImGui_ImplSoftRaster_Channel(v[i]->col, IM_COL32_A_SHIFT);
+            attr[i][ImGui_ImplSoftRaster_Attr_U] = v[i]->uv.x;
+            attr[i][ImGui_ImplSoftRaster_Attr_V] = v[i]->uv.y;
+        }
+        const float dx1 = (float)(fx[1] - fx[0]) / 16.0f, dy1 = (float)(fy[1] - fy[0]) / 16.0f;
+        const float dx2 = (float)(fx[2] - fx[0]) / 16.0f, dy2 = (float)(fy[2] - fy[0]) / 16.0f;
+        const float inv_det = 256.0f / (float)area;
+        tri.BaseX = (float)fx[0] / 16.0f;
+        tri.BaseY = (float)fy[0] / 16.0f;
+        for (int a = 0; a < ImGui_ImplSoftRaster_Attr_COUNT; a++)
+        {
+            const float da1 = attr[1][a] - attr[0][a];
+            const float da2 = attr[2][a] - attr[0][a];
+            tri.Attr[a] = attr[0][a];
+            tri.AttrDx[a] = (da1 * dy2 - da2 * dy1) * inv_det;
+            tri.AttrDy[a] = (da2 * dx1 - da1 * dx2) * inv_det;
+        }
+    }
+
+    // Edge functions. Edge 'e' goes from vertex (e+1)%3 to (e+2)%3 and is positive on the side of vertex 'e'.
+    // Top-left rule: pixels exactly on an edge belong to only one of the two triangles sharing it.
+    for (int e = 0; e < 3; e++)
+    {
+        const int a = (e + 1) % 3, b = (e + 2) % 3;
+        const int edge_a = fy[a] - fy[b];
+        const int edge_b = fx[b] - fx[a];
+        const ImS64 edge_c = (ImS64)fx[a] * fy[b] - (ImS64)fy[a] * fx[b];
+        const bool is_top_left = (edge_a > 0) || (edge_a == 0 && edge_b > 0);
+        tri.EdgeStepX[e] = edge_a * 16;
+        tri.EdgeStepY[e] = edge_b * 16;
+        tri.EdgeOrigin[e] = edge_c + (ImS64)edge_a * 8 + (ImS64)edge_b * 8 + (is_top_left ? 0 : -1);
+    }
+
+    ImGui_ImplSoftRaster_WalkTiles(tri, target);
+}
+
+//-----------------------------------------------------------------------------
+// Draw data rendering
+//-----------------------------------------------------------------------------
+
+struct ImGui_ImplSoftRaster_RenderJob
+{
+    ImDrawData*                 DrawData;
+    ImGui_ImplSoftRaster_Image* Target;
+    int                         FbWidth;
+    int                         FbHeight;
+    int                         BandHeight;
+    ImVec2                      ClipOff;
+    ImVec2                      ClipScale;
+    const ImDrawDataTileTracker* Tiles;         // When rendering dirty tiles only
+    const int*                  DirtySpans;
+    ImU32                       ClearCol;
+};
+
+// Rasterize all commands over [rect_x0, rect_x1) x [rect_y0, rect_y1)
+static void ImGui_ImplSoftRaster_RenderRect(const ImGui_ImplSoftRaster_RenderJob* job, int rect_x0, int rect_y0, int rect_x1, int rect_y1)
+{
+    ImDrawData* draw_data = job->DrawData;
+    const ImVec2 clip_off = job->ClipOff;
+    const ImVec2 clip_scale = job->ClipScale;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        // Regular per-list buffers, or arena where all ImDrawCmd offsets are absolute
+        const ImDrawVert* vtx_buffer = draw_data->ArenaVtxBuffer ? draw_data->ArenaVtxBuffer : draw_list->VtxBuffer.Data;
+        const void* idx_buffer = draw_data->ArenaIdxBuffer ? draw_data->ArenaIdxBuffer : (const void*)draw_list->IdxBuffer.Data;
+
+        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                // (Only reached when rendering everything at once, see ImGui_ImplSoftRaster_RenderDrawDataEx())
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(draw_list, pcmd);
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
+            if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
+            if (clip_max.x > (float)job->FbWidth) { clip_max.x = (float)job->FbWidth; }
+            if (clip_max.y > (float)job->FbHeight) { clip_max.y = (float)job->FbHeight; }
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+            const int clip_x0 = ImGui_ImplSoftRaster_Max((int)clip_min.x, rect_x0);
+            const int clip_x1 = ImGui_ImplSoftRaster_Min((int)clip_max.x, rect_x1);
+            const int clip_y0 = ImGui_ImplSoftRaster_Max((int)clip_min.y, rect_y0);
+            const int clip_y1 = ImGui_ImplSoftRaster_Min((int)clip_max.y, rect_y1);
+            if (clip_x1 <= clip_x0 || clip_y1 <= clip_y0)
+                continue;
+
+            // Draw
+            const ImGui_ImplSoftRaster_Image* tex = (const ImGui_ImplSoftRaster_Image*)(intptr_t)pcmd->GetTexID();
+            const ImDrawVert* vtx = vtx_buffer + pcmd->VtxOffset;
+            if (draw_data->IdxSize == 2)
+            {
+                const ImU16* idx = (const ImU16*)idx_buffer + pcmd->IdxOffset;
+                for (unsigned int n = 0; n + 2 < pcmd->ElemCount; n += 3)
+                    ImGui_ImplSoftRaster_RasterTriangle(job->Target, &vtx[idx[n]], &vtx[idx[n + 1]], &vtx[idx[n + 2]], tex, clip_off, clip_scale, clip_x0, clip_y0, clip_x1, clip_y1);
+            }
+            else
+            {
+                const ImU32* idx = (const ImU32*)idx_buffer + pcmd->IdxOffset;
+                for (unsigned int n = 0; n + 2 < pcmd->ElemCount; n += 3)
+                    ImGui_ImplSoftRaster_RasterTriangle(job->Target, &vtx[idx[n]], &vtx[idx[n + 1]], &vtx[idx[n + 2]], tex, clip_off, clip_scale, clip_x0, clip_y0, clip_x1, clip_y1);
+            }
+        }
+    }
+}
+
+static void ImGui_ImplSoftRaster_RenderBandJobFunc(void* data, int band_n)
+{
+    const ImGui_ImplSoftRaster_RenderJob* job = (const ImGui_ImplSoftRaster_RenderJob*)data;
+    const int band_y0 = band_n * job->BandHeight;
+    const int band_y1 = ImGui_ImplSoftRaster_Min(band_y0 + job->BandHeight, job->FbHeight);
+    ImGui_ImplSoftRaster_RenderRect(job, 0, band_y0, job->FbWidth, band_y1);
+}
+
+static void ImGui_ImplSoftRaster_ClearRect(ImGui_ImplSoftRaster_Image* target, int x0, int y0, int x1, int y1, ImU32 col)
+{
+    for (int y = y0; y < y1; y++)
+    {
+        ImU32* row = (ImU32*)(void*)((char*)target->Pixels + (size_t)y * target->Pitch);
+        for (int x = x0; x < x1; x++)
+            row[x] = col;
+    }
+}
+
+// Redraw a span of tiles on one row. Clean tiles between dirty ones are redrawn identically,
+// this is cheaper than walking all triangles once per dirty tile.
+static void ImGui_ImplSoftRaster_RenderDirtySpanJobFunc(void* data, int span_n)
+{
+    const ImGui_ImplSoftRaster_RenderJob* job = (const ImGui_ImplSoftRaster_RenderJob*)data;
+    const int* span = &job->DirtySpans[span_n * 3];
+    const int tiles_x = job->Tiles->TilesX;
+    ImVec2 first_min, first_max, last_min, last_max;
+    job->Tiles->GetTileRect(span[0] * tiles_x + span[1], &first_min, &first_max);
+    job->Tiles->GetTileRect(span[0] * tiles_x + span[2], &last_min, &last_max);
+    const int x0 = (int)first_min.x, y0 = (int)first_min.y;
+    const int x1 = ImGui_ImplSoftRaster_Min((int)last_max.x, job->FbWidth);
+    const int y1 = ImGui_ImplSoftRaster_Min((int)last_max.y, job->FbHeight);
+    if (x1 <= x0 || y1 <= y0)
+        return;
+    ImGui_ImplSoftRaster_ClearRect(job->Target, x0, y0, x1, y1, job->ClearCol);
+    ImGui_ImplSoftRaster_RenderRect(job, x0, y0, x1, y1);
+}
+
+static void ImGui_ImplSoftRaster_RenderDrawDataEx(ImDrawData* draw_data, ImGui_ImplSoftRaster_Image* target, const ImDrawDataTileTracker* tiles, ImU32 clear_col)
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoftRaster_Init()?");
+    IM_ASSERT(target != nullptr && target->Pixels != nullptr && target->Pitch >= target->Width * 4);
+
+    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
+    const int fb_width = ImGui_ImplSoftRaster_Min((int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x), target->Width);
+    const int fb_height = ImGui_ImplSoftRaster_Min((int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y), target->Height);
+    if (fb_width <= 0 || fb_height <= 0)
+        return;
+
+    // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
+    // (This almost always points to ImGui::GetPlatformIO().Textures[] but is part of ImDrawData to allow overriding or disabling texture updates).
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                ImGui_ImplSoftRaster_UpdateTexture(tex);
+
+    // Setup render state structure (for callbacks and custom texture bindings)
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    ImGui_ImplSoftRaster_RenderState render_state;
+    render_state.Target = target;
+    platform_io.Renderer_RenderState = &render_state;
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImGui_ImplSoftRaster_RenderJob job;
+    job.DrawData = draw_data;
+    job.Target = target;
+    job.FbWidth = fb_width;
+    job.FbHeight = fb_height;
+    job.BandHeight = bd->BandHeight;
+    job.ClipOff = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    job.ClipScale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+    job.Tiles = tiles;
+    job.DirtySpans = nullptr;
+    job.ClearCol = clear_col;
+
+    // User callbacks may write to the target and expect to be called once in order: process everything at once.
+    bool has_callbacks = false;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+            if (cmd.UserCallback != nullptr && cmd.UserCallback != ImDrawCallback_ResetRenderState)
+                has_callbacks = true;
+
+    const int bands_count = (fb_height + job.BandHeight - 1) / job.BandHeight;
+    if (has_callbacks)
+    {
+        if (tiles != nullptr)
+            ImGui_ImplSoftRaster_ClearRect(target, 0, 0, fb_width, fb_height, clear_col);
+        ImGui_ImplSoftRaster_RenderRect(&job, 0, 0, fb_width, fb_height);
+    }
+    else if (tiles != nullptr)
+    {
+        // Merge dirty tiles into one span per row (DirtyTiles[] is sorted)
+        bd->DirtySpans.resize(0);
+        for (int tile_n : tiles->DirtyTiles)
+        {
+            const int tile_x = tile_n % tiles->TilesX;
+            const int tile_y = tile_n / tiles->TilesX;
+            if (bd->DirtySpans.Size > 0 && bd->DirtySpans[bd->DirtySpans.Size - 3] == tile_y)
+                bd->DirtySpans[bd->DirtySpans.Size - 1] = tile_x;
+            else
+            {
+                bd->DirtySpans.push_back(tile_y);
+                bd->DirtySpans.push_back(tile_x);
+                bd->DirtySpans.push_back(tile_x);
+            }
+        }
+        job.DirtySpans = bd->DirtySpans.Data;
+        const int spans_count = bd->DirtySpans.Size / 3;
+        if (platform_io.Platform_ParallelForFn != nullptr && spans_count > 1)
+            platform_io.Platform_ParallelForFn(ImGui::GetCurrentContext(), spans_count, ImGui_ImplSoftRaster_RenderDirtySpanJobFunc, &job);
+        else
+            for (int span_n = 0; span_n < spans_count; span_n++)
+                ImGui_ImplSoftRaster_RenderDirtySpanJobFunc(&job, span_n);
+    }
+    else if (platform_io.Platform_ParallelForFn != nullptr && bands_count > 1)
+        platform_io.Platform_ParallelForFn(ImGui::GetCurrentContext(), bands_count, ImGui_ImplSoftRaster_RenderBandJobFunc, &job);
+    else
+        for (int band_n = 0; band_n < bands_count; band_n++)
+            ImGui_ImplSoftRaster_RenderBandJobFunc(&job, band_n);
+
+    platform_io.Renderer_RenderState = nullptr;
+}
+
+void ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, ImGui_ImplSoftRaster_Image* target)
+{
+    ImGui_ImplSoftRaster_RenderDrawDataEx(draw_data, target, nullptr, 0);
+}
+
+void ImGui_ImplSoftRaster_RenderDrawDataTiles(ImDrawData* draw_data, ImGui_ImplSoftRaster_Image* target, const ImDrawDataTileTracker* tiles, ImU32 clear_col)
+{
+    IM_ASSERT(tiles != nullptr && tiles->TileHashes.Size == tiles->TilesX * tiles->TilesY && "Call tiles->Update(draw_data) first!");
+    ImGui_ImplSoftRaster_RenderDrawDataEx(draw_data, target, tiles, clear_col);
+}
+
+//-----------------------------------------------------------------------------
+// Textures
+//-----------------------------------------------------------------------------
+
+static void ImGui_ImplSoftRaster_CopyTextureRect(ImGui_ImplSoftRaster_Image* image, ImTextureData* tex, int x, int y, int w, int h)
+{
+    for (int row_y = y; row_y < y + h; row_y++)
+    {
+        ImU32* dst = (ImU32*)(void*)((char*)image->Pixels + (size_t)row_y * image->Pitch) + x;
+        const unsigned char* src = (const unsigned char*)tex->GetPixelsAt(x, row_y);
+        if (tex->Format == ImTextureFormat_Alpha8)
+            for (int n = 0; n < w; n++)
+                dst[n] = IM_COL32(255, 255, 255, src[n]);
+        else
+            for (int n = 0; n < w; n++, src += 4)
+                dst[n] = IM_COL32(src[0], src[1], src[2], src[3]);
+    }
+}
+
+void ImGui_ImplSoftRaster_UpdateTexture(ImTextureData* tex)
+{
+    if (tex->Status == ImTextureStatus_WantCreate)
+    {
+        // Create texture. Pixels are stored right after the image header.
+        //IMGUI_DEBUG_LOG("UpdateTexture #%03d: WantCreate %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
+        IM_ASSERT(tex->TexID == 0 && tex->BackendUserData == nullptr);
+        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32 || tex->Format == ImTextureFormat_Alpha8);
+        ImGui_ImplSoftRaster_Image* image = (ImGui_ImplSoftRaster_Image*)IM_ALLOC(sizeof(ImGui_ImplSoftRaster_Image) + (size_t)tex->Width * tex->Height * 4);
+        image->Pixels = (ImU32*)(void*)(image + 1);
+        image->Width = tex->Width;
+        image->Height = tex->Height;
+        image->Pitch = tex->Width * 4;
+        ImGui_ImplSoftRaster_CopyTextureRect(image, tex, 0, 0, tex->Width, tex->Height);
+
+        // Store identifiers
+        tex->SetTexID((ImTextureID)(intptr_t)image);
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantUpdates)
+    {
+        // Update selected blocks. We only ever write to textures regions which have never been used before!
+        // This backend choose to use tex->Updates[] but you can use tex->UpdateRect to upload a single region.
+        ImGui_ImplSoftRaster_Image* image = (ImGui_ImplSoftRaster_Image*)(intptr_t)tex->TexID;
+        for (ImTextureRect& r : tex->Updates)
+            ImGui_ImplSoftRaster_CopyTextureRect(image, tex, r.x, r.y, r.w, r.h);
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantDestroy)
+    {
+        if (ImGui_ImplSoftRaster_Image* image = (ImGui_ImplSoftRaster_Image*)(intptr_t)tex->TexID)
+            IM_FREE(image);
+
+        // Clear identifiers and mark as destroyed (in order to allow e.g. calling InvalidateDeviceObjects while running)
+        tex->SetTexID(ImTextureID_Invalid);
+        tex->SetStatus(ImTextureStatus_Destroyed);
+    }
+}
+
+void ImGui_ImplSoftRaster_CreateDeviceObjects()
+{
+}
+
+void ImGui_ImplSoftRaster_DestroyDeviceObjects()
+{
+    // Destroy all textures
+    for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+        if (tex->RefCount == 1)
+        {
+            tex->SetStatus(ImTextureStatus_WantDestroy);
+            ImGui_ImplSoftRaster_UpdateTexture(tex);
+        }
+}
+
+//-----------------------------------------------------------------------------
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,59 @@
+// dear imgui: Renderer Backend for CPU software rasterization
+// This rasterizes ImDrawData into a 32-bit color buffer in memory. No GPU or graphics API involved.
+// This is designed for headless rendering: golden-image tests, screenshots and thumbnails, remote displays.
+// Output only depends on ImDrawData contents, not on the number of threads used.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Image*' as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Packed 16-bit indices and draw data arenas (ImGuiBackendFlags_RendererHasIdxSize, ImDrawData::ArenaVtxBuffer).
+//  [X] Renderer: Multi-threaded rasterization using platform_io.Platform_ParallelForFn when set.
+//  [X] Renderer: Redraw only changed tiles with ImGui_ImplSoftRaster_RenderDrawDataTiles() + ImDrawDataTileTracker.
+//  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+// Image in memory, used both as render target and as texture.
+// Pixels are ImU32 colors packed the same way as IM_COL32() (RGBA bytes in memory on little-endian, unless IMGUI_USE_BGRA_PACKED_COLOR is defined), with non-premultiplied alpha.
+struct ImGui_ImplSoftRaster_Image
+{
+    ImU32*              Pixels;
+    int                 Width;
+    int                 Height;
+    int                 Pitch;      // Number of bytes between two rows (>= Width * 4)
+};
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_Init();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, ImGui_ImplSoftRaster_Image* target); // Blend over existing contents of 'target': clear it yourself if needed. Rendering is clipped to min(target size, DisplaySize * FramebufferScale).
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawDataTiles(ImDrawData* draw_data, ImGui_ImplSoftRaster_Image* target, const ImDrawDataTileTracker* tiles, ImU32 clear_col); // Clear to 'clear_col' and redraw only tiles->DirtyTiles[], leaving other pixels untouched. Call tiles->Update(draw_data) first.
+
+// Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_CreateDeviceObjects();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_DestroyDeviceObjects();
+
+// (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = NULL to handle this manually.
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_UpdateTexture(ImTextureData* tex);
+
+// [BETA] Selected render state data shared with callbacks.
+// This is temporarily stored in GetPlatformIO().Renderer_RenderState during the ImGui_ImplSoftRaster_RenderDrawData() call.
+// When draw data contains user callbacks, rasterization happens on the calling thread, in submission order.
+struct ImGui_ImplSoftRaster_RenderState
+{
+    ImGui_ImplSoftRaster_Image* Target;
+};
+
+#endif // #ifndef IMGUI_DISABLE
@@ -1,18 +1,1153 @@
 // dear imgui: "null" example application
 // (compile and link imgui, create context, run headless with NO INPUTS, NO GRAPHICS OUTPUT)
 // This is useful to test building, but you cannot interact with anything here!
+//
+// Running with '--bench' turns this into a headless CPU benchmark: a set of scripted workloads is run through
+// NewFrame()/Render() and we report per-phase timings, heap allocations, vertex/index counts and draw command counts.
+// - Usage: example_null --bench [--frames N] [--warmup N] [--threads N] [--arena] [--merge] [--softraster] [--save-tga prefix] [--tiles] [--skip-unchanged] [--fill-tex] [--text-cache] [--async-glyphs] [--multi-page] [--font-cache prefix] [--checksum] [--font file.ttf] [--csv] [workload_name ...]
+// - Build with optimizations for meaningful numbers, e.g. 'CXXFLAGS=-O2 make'.
+// - The RenderDrawData phase copies all vertices/indices into a single upload arena, as a real renderer would.
+// - '--threads N' (N > 1) installs a thread pool as platform_io.Platform_ParallelForFn, used by ImDrawData functions.
+// - '--arena' sets platform_io.Renderer_GetDrawDataArenaFn so Render() writes directly into the upload arena.
+// - '--merge' sets io.ConfigRenderMergeDrawLists.
+// - '--softraster' uses imgui_impl_softraster instead of the null renderer, rasterizing every frame into a 1920x1080 image.
+// - '--save-tga prefix' (implies '--softraster') writes the last rendered image of each workload to 'prefix<workload>.tga'.
+// - '--tiles' updates a ImDrawDataTileTracker every frame and reports the average percentage of dirty tiles.
+//   With '--softraster', only dirty tiles are redrawn into a persistent image: checksum must be identical to full redraws.
+// - '--skip-unchanged' sets io.ConfigRenderDetectUnchangedFrames and skips the RenderDrawData phase when ImDrawData::Unchanged is set,
+//   reporting the percentage of skipped frames. Checksum must be identical to runs without it.
+// - '--fill-tex' sets style.AntiAliasedFillUseTex: rounded rectangles and circles are drawn using baked textures instead of polygons.
+// - '--text-cache' sets io.ConfigTextLayoutCache. Checksum must be identical to runs without it when using the default font.
+// - '--async-glyphs' sets ImFontAtlasFlags_AsyncGlyphLoad and starts one std::async() task per frame to rasterize new glyphs.
+//   New glyphs are drawn blank until their task completes, so checksum differs from runs without it when glyphs are loaded during recorded frames.
+// - '--multi-page' sets ImFontAtlasFlags_MultiPage: once the atlas texture reaches 1024x1024, new glyphs go to extra 1024x1024 textures
+//   instead of growing and repacking it. Compare 'max_ms' on 'font_growth'. Checksum is identical to runs without it until extra pages are used,
+//   after which UV and draw commands differ ('--save-tga' images only differ by rounding of bilinear filtering).
+// - '--font-cache prefix' loads glyphs from 'prefix<workload>.bin' on startup and saves them there on exit (ImFontAtlas::LoadCacheFromFile()),
+//   and reports 'startup_ms': time from CreateContext() to the end of the first frame. Run twice to measure with a warm cache.
+//   Glyphs are packed at different locations than when rasterized in order, so only the '--softraster' checksum is comparable.
+// - '--checksum' hashes all triangles as a GPU would fetch and clip them from the upload arena. Output must be identical with and without '--arena' or '--merge'.
+//   With '--softraster' the rendered image is hashed as well, which may be used for golden-image tests (output is identical with any '--threads' value).
+// - Timings are wall-clock and include everything between the phase boundaries. Compare runs on the same machine only.
 #include "imgui.h"
+#include "imgui_internal.h" // ImTextCountCharsFromUtf8(), TextEx()
 #include <stdio.h>
+#include <stdlib.h>         // atoi, malloc, free
+#include <math.h>           // sinf, fminf, fmaxf
+#include <string.h>         // strcmp
+#include <chrono>
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
 
 // For imgui_impl_null: use relative filename + embed implementation directly by including the .cpp file.
 // This is to simplify casual building of this example from all sorts of test scripts.
 #include "../../backends/imgui_impl_null.h"
 #include "../../backends/imgui_impl_null.cpp"
+#include "../../backends/imgui_impl_softraster.h"
+#include "../../backends/imgui_impl_softraster.cpp"
 
-int main(int, char**)
+//-----------------------------------------------------------------------------
+// Benchmark: allocation tracking
+//-----------------------------------------------------------------------------
+
+// Atomic as fonts may allocate from worker threads with '--async-glyphs'.
+struct BenchAllocStats
+{
+    std::atomic<int>    AllocCount{ 0 };
+    std::atomic<size_t> AllocBytes{ 0 };
+};
+static BenchAllocStats g_BenchAllocs;
+
+static void* BenchMallocWrapper(size_t size, void* user_data)
+{
+    BenchAllocStats* stats = (BenchAllocStats*)user_data;
+    stats->AllocCount++;
+    stats->AllocBytes += size;
+    return malloc(size);
+}
+
+static void BenchFreeWrapper(void* ptr, void* user_data)
+{
+    IM_UNUSED(user_data);
+    free(ptr);
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: thread pool for platform_io.Platform_ParallelForFn
+//-----------------------------------------------------------------------------
+
+// Minimal job system: workers and the calling thread grab indices from a shared counter until exhausted.
+struct BenchThreadPool
+{
+    static const int        MAX_THREADS = 16;
+    std::thread             Threads[MAX_THREADS];
+    int                     ThreadsCount = 0;
+    std::mutex              Mutex;
+    std::condition_variable WakeCond;
+    std::condition_variable DoneCond;
+    int                     Generation = 0;     // Incremented for every loop
+    int                     Busy = 0;           // Number of workers not done with current loop
+    bool                    Quit = false;
+    void                    (*Func)(void* func_data, int index) = nullptr;
+    void*                   FuncData = nullptr;
+    int                     Count = 0;
+    std::atomic<int>        NextIndex;
+};
+
+static void BenchThreadPoolRunJobs(BenchThreadPool* pool)
+{
+    for (int n = pool->NextIndex.fetch_add(1); n < pool->Count; n = pool->NextIndex.fetch_add(1))
+        pool->Func(pool->FuncData, n);
+}
+
+static void BenchThreadPoolWorkerMain(BenchThreadPool* pool)
+{
+    int generation = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(pool->Mutex);
+            pool->WakeCond.wait(lock, [&] { return pool->Quit || pool->Generation != generation; });
+            if (pool->Quit)
+                return;
+            generation = pool->Generation;
+        }
+        BenchThreadPoolRunJobs(pool);
+        std::lock_guard<std::mutex> lock(pool->Mutex);
+        if (--pool->Busy == 0)
+            pool->DoneCond.notify_one();
+    }
+}
+
+static void BenchParallelFor(ImGuiContext*, int count, void (*func)(void* func_data, int index), void* func_data)
+{
+    BenchThreadPool* pool = (BenchThreadPool*)ImGui::GetPlatformIO().Platform_ParallelForUserData;
+    {
+        std::lock_guard<std::mutex> lock(pool->Mutex);
+        pool->Func = func;
+        pool->FuncData = func_data;
+        pool->Count = count;
+        pool->NextIndex = 0;
+        pool->Busy = pool->ThreadsCount;
+        pool->Generation++;
+    }
+    pool->WakeCond.notify_all();
+    BenchThreadPoolRunJobs(pool);
+    std::unique_lock<std::mutex> lock(pool->Mutex);
+    pool->DoneCond.wait(lock, [&] { return pool->Busy == 0; });
+}
+
+// 'threads_count' includes the calling thread.
+static void BenchThreadPoolStart(BenchThreadPool* pool, int threads_count)
+{
+    pool->ThreadsCount = (threads_count < BenchThreadPool::MAX_THREADS ? threads_count : BenchThreadPool::MAX_THREADS) - 1;
+    for (int n = 0; n < pool->ThreadsCount; n++)
+        pool->Threads[n] = std::thread(BenchThreadPoolWorkerMain, pool);
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    platform_io.Platform_ParallelForFn = BenchParallelFor;
+    platform_io.Platform_ParallelForUserData = pool;
+}
+
+static void BenchThreadPoolStop(BenchThreadPool* pool)
+{
+    {
+        std::lock_guard<std::mutex> lock(pool->Mutex);
+        pool->Quit = true;
+    }
+    pool->WakeCond.notify_all();
+    for (int n = 0; n < pool->ThreadsCount; n++)
+        pool->Threads[n].join();
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    platform_io.Platform_ParallelForFn = nullptr;
+    platform_io.Platform_ParallelForUserData = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: platform_io.Platform_AsyncJobStartFn/Platform_AsyncJobWaitFn for '--async-glyphs'
+//-----------------------------------------------------------------------------
+
+static void* BenchAsyncJobStart(ImGuiContext*, void (*func)(void* func_data), void* func_data)
+{
+    return new std::future<void>(std::async(std::launch::async, func, func_data));
+}
+
+static bool BenchAsyncJobWait(ImGuiContext*, void* job_handle, bool blocking)
+{
+    std::future<void>* future = (std::future<void>*)job_handle;
+    if (blocking)
+        future->wait();
+    else if (future->wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+    delete future;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: statistics
+//-----------------------------------------------------------------------------
+
+enum BenchPhase
+{
+    BenchPhase_NewFrame,        // Backends NewFrame + ImGui::NewFrame()
+    BenchPhase_Build,           // Workload code (Begin/End, widgets, ImDrawList calls)
+    BenchPhase_Render,          // ImGui::Render() (EndFrame + draw data setup)
+    BenchPhase_RenderDrawData,  // Renderer backend RenderDrawData() + copy to upload arena (+ rasterization with '--softraster')
+    BenchPhase_COUNT
+};
+static const char* BenchPhaseNames[BenchPhase_COUNT] = { "NewFrame", "Build", "Render", "RenderDrawData" };
+
+struct BenchStat
+{
+    double  Sum = 0.0;
+    double  Min = 0.0;
+    double  Max = 0.0;
+    int     Count = 0;
+
+    void    Add(double v)   { Min = (Count == 0 || v < Min) ? v : Min; Max = (Count == 0 || v > Max) ? v : Max; Sum += v; Count++; }
+    double  Avg() const     { return Count > 0 ? Sum / Count : 0.0; }
+};
+
+struct BenchResult
+{
+    BenchStat   PhaseMs[BenchPhase_COUNT];
+    BenchStat   FrameMs;
+    BenchStat   Allocs;
+    BenchStat   AllocBytes;
+    BenchStat   VtxCount;
+    BenchStat   IdxCount;
+    BenchStat   CmdCount;
+    BenchStat   ListCount;
+    BenchStat   DirtyTilesPercent;
+    BenchStat   UnchangedPercent;
+    double      StartupMs = 0.0;    // CreateContext() to end of first frame, with '--font-cache'
+    ImU32       Checksum = 0;
+};
+
+struct BenchConfig
+{
+    int         Frames = 100;
+    int         WarmupFrames = 10;
+    int         ThreadsCount = 1;
+    bool        UseArena = false;
+    bool        MergeDrawLists = false;
+    bool        SoftRaster = false;
+    bool        DirtyTiles = false;
+    bool        SkipUnchanged = false;
+    bool        FillUseTex = false;
+    bool        TextLayoutCache = false;
+    bool        AsyncGlyphs = false;
+    bool        MultiPage = false;
+    bool        Checksum = false;
+    const char* SaveTgaPrefix = nullptr;
+    const char* FontFilename = nullptr;
+    const char* FontCachePrefix = nullptr;
+};
+
+typedef std::chrono::steady_clock BenchClock;
+static double BenchElapsedMs(BenchClock::time_point t0, BenchClock::time_point t1) { return std::chrono::duration<double, std::milli>(t1 - t0).count(); }
+
+//-----------------------------------------------------------------------------
+// Benchmark: workloads
+//-----------------------------------------------------------------------------
+
+// Each workload submits a frame worth of UI. Workloads are expected to be deterministic given 'frame'.
+struct BenchWorkload
+{
+    const char* Name;
+    const char* Desc;
+    void        (*Frame)(int frame);
+};
+
+static void BenchBeginFullscreenWindow(const char* name, ImGuiWindowFlags flags = 0)
+{
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(viewport->WorkPos);
+    ImGui::SetNextWindowSize(viewport->WorkSize);
+    ImGui::Begin(name, NULL, flags | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove);
+}
+
+static void Workload_Demo(int frame)
+{
+    IM_UNUSED(frame);
+    ImGui::ShowDemoWindow(NULL);
+}
+
+// 10k rows submitted without a clipper (worst case for table layout and item submission)
+static void Workload_Table10k(int frame)
+{
+    IM_UNUSED(frame);
+    BenchBeginFullscreenWindow("Table10k");
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("table", 4, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("ID");
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableSetupColumn("Flags");
+        ImGui::TableHeadersRow();
+        for (int row = 0; row < 10000; row++)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%05d", row);
+            ImGui::TableNextColumn();
+            ImGui::Text("Item %d", row * 7);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", row * 0.125f);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted((row & 1) ? "odd" : "even");
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Many small tables with frozen rows/columns and horizontal scrolling: each EndTable() merges ~70 draw channels
+static void Workload_TableWide(int frame)
+{
+    IM_UNUSED(frame);
+    BenchBeginFullscreenWindow("TableWide", ImGuiWindowFlags_NoScrollbar);
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY;
+    const ImVec2 table_size(ImGui::GetContentRegionAvail().x / 4 - ImGui::GetStyle().ItemSpacing.x, ImGui::GetContentRegionAvail().y / 6 - ImGui::GetStyle().ItemSpacing.y);
+    for (int table_n = 0; table_n < 24; table_n++)
+    {
+        if (table_n % 4 != 0)
+            ImGui::SameLine();
+        ImGui::PushID(table_n);
+        if (ImGui::BeginTable("table", 32, flags, table_size))
+        {
+            ImGui::TableSetupScrollFreeze(1, 1);
+            for (int column = 0; column < 32; column++)
+                ImGui::TableSetupColumn(column == 0 ? "Row" : "Col", ImGuiTableColumnFlags_WidthFixed, 48.0f);
+            ImGui::TableHeadersRow();
+            for (int row = 0; row < 12; row++)
+            {
+                ImGui::TableNextRow();
+                for (int column = 0; column < 32; column++)
+                {
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%d,%d", row, column);
+                }
+            }
+            ImGui::EndTable();
+        }
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+// InputTextMultiline() over a multi-megabyte buffer, active (focused) from the first frame
+static void Workload_InputTextHuge(int frame)
+{
+    static ImVector<char> buf;
+    if (buf.empty())
+    {
+        const int line_count = 50000;
+        ImGuiTextBuffer text;
+        text.reserve(line_count * 48);
+        for (int n = 0; n < line_count; n++)
+            text.appendf("%06d: The quick brown fox jumps over the lazy dog.\n", n);
+        buf.resize(text.size() + 1024);
+        memcpy(buf.Data, text.c_str(), (size_t)text.size() + 1);
+    }
+    BenchBeginFullscreenWindow("InputTextHuge");
+    if (frame == 0)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputTextMultiline("##text", buf.Data, (size_t)buf.Size, ImVec2(-FLT_MIN, -FLT_MIN));
+    ImGui::End();
+}
+
+// Thousands of small top-level windows
+static void Workload_Windows2k(int frame)
+{
+    IM_UNUSED(frame);
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    for (int n = 0; n < 2000; n++)
+    {
+        char name[32];
+        snprintf(name, IM_ARRAYSIZE(name), "Window %04d", n);
+        ImGui::SetNextWindowPos(ImVec2(viewport->WorkPos.x + (float)((n * 37) % 1700), viewport->WorkPos.y + (float)((n * 53) % 950)));
+        ImGui::SetNextWindowSize(ImVec2(200, 120));
+        ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::Text("Window %d", n);
+        ImGui::Button("Button");
+        ImGui::SameLine();
+        ImGui::SmallButton("Small");
+        ImGui::End();
+    }
+}
+
+// Dense ImDrawList paths: anti-aliased polylines, circles, curves and rounded rectangles
+static void Workload_DrawList(int frame)
+{
+    BenchBeginFullscreenWindow("DrawList");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const float phase = (float)frame * 0.1f;
+
+    static ImVector<ImVec2> points;
+    for (int line_n = 0; line_n < 40; line_n++)
+    {
+        points.resize(0);
+        for (int n = 0; n < 1000; n++)
+            points.push_back(ImVec2(origin.x + n * 1.8f, origin.y + 20.0f + line_n * 25.0f + sinf(n * 0.05f + phase + line_n) * 10.0f));
+        draw_list->AddPolyline(points.Data, points.Size, IM_COL32(255, 200, 0, 255), ImDrawFlags_None, (line_n & 1) ? 1.0f : 2.5f);
+    }
+    for (int n = 0; n < 2000; n++)
+    {
+        ImVec2 center(origin.x + (float)((n * 37) % 1800), origin.y + (float)((n * 91) % 1000));
+        if (n & 1)
+            draw_list->AddCircleFilled(center, 6.0f + (n % 7), IM_COL32(0, 160, 255, 200));
+        else
+            draw_list->AddCircle(center, 6.0f + (n % 7), IM_COL32(255, 255, 255, 200), 0, 1.5f);
+    }
+    for (int n = 0; n < 300; n++)
+    {
+        ImVec2 p0(origin.x + (float)((n * 29) % 1800), origin.y + (float)((n * 61) % 1000));
+        draw_list->AddBezierCubic(p0, ImVec2(p0.x + 80, p0.y - 60), ImVec2(p0.x + 120, p0.y + 60), ImVec2(p0.x + 200, p0.y), IM_COL32(255, 0, 128, 255), 2.0f);
+    }
+    for (int n = 0; n < 2000; n++)
+    {
+        ImVec2 p0(origin.x + (float)((n * 43) % 1800), origin.y + (float)((n * 17) % 1000));
+        draw_list->AddRectFilled(p0, ImVec2(p0.x + 30, p0.y + 16), IM_COL32(64, 64, 64 + (n % 192), 255), 4.0f);
+    }
+    ImGui::End();
+}
+
+// Oscilloscope-style traces: long anti-aliased polylines going through each AddPolyline() path.
+// (16000 points per call keeps the thickest geometry path under 64k vertices, as required with 16-bit indices)
+static void Workload_Polyline(int frame)
+{
+    IM_UNUSED(frame);
+    BenchBeginFullscreenWindow("Polyline");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImDrawListFlags backup_flags = draw_list->Flags;
+
+    // Points are generated once so we only measure AddPolyline()
+    const int trace_count = 10;
+    const int points_per_trace = 16000;
+    static ImVector<ImVec2> points;
+    if (points.empty())
+        for (int trace_n = 0; trace_n < trace_count; trace_n++)
+            for (int n = 0; n < points_per_trace; n++)
+                points.push_back(ImVec2(10.0f + n * 0.11f, 50.0f + trace_n * 90.0f + sinf(n * 0.013f + trace_n) * 30.0f + sinf(n * 0.71f) * 6.0f));
+
+    const float thickness_list[] = { 1.0f, 3.0f, 1.0f, 2.5f, 2.0f };
+    for (int trace_n = 0; trace_n < trace_count; trace_n++)
+    {
+        const bool closed = (trace_n >= 5);
+        if ((trace_n % 5) == 2 || (trace_n % 5) == 4)
+            draw_list->Flags &= ~ImDrawListFlags_AntiAliasedLinesUseTex; // Exercise the geometry paths for thin and thick lines
+        draw_list->AddPolyline(&points[trace_n * points_per_trace], points_per_trace, IM_COL32(0, 255, 128, 255), closed ? ImDrawFlags_Closed : ImDrawFlags_None, thickness_list[trace_n % 5]);
+        draw_list->Flags = backup_flags;
+    }
+    ImGui::End();
+}
+
+// Map style shapes: large concave polygons with irregular outlines, some of them with holes (lakes).
+static void Workload_Concave(int frame)
+{
+    IM_UNUSED(frame);
+    BenchBeginFullscreenWindow("Concave");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+
+    // Points are generated once so we only measure AddConcavePolyFilled()
+    const int shape_count = 12;
+    const int outline_points = 4000;
+    const int hole_points = 500;
+    static ImVector<ImVec2> points;
+    static ImVector<int> contours;
+    if (points.empty())
+        for (int shape_n = 0; shape_n < shape_count; shape_n++)
+        {
+            const ImVec2 center(170.0f + (shape_n % 4) * 320.0f, 170.0f + (shape_n / 4) * 320.0f);
+            const int holes_count = (shape_n % 3 == 0) ? 2 : 0;
+            for (int n = 0; n < outline_points; n++)
+            {
+                const float a = n * 6.2831853f / outline_points;
+                const float r = 110.0f + sinf(a * 7.0f + shape_n) * 25.0f + sinf(a * 61.0f) * 8.0f + sinf(a * 907.0f) * 2.0f;
+                points.push_back(ImVec2(center.x + cosf(a) * r, center.y + sinf(a) * r));
+            }
+            for (int hole_n = 0; hole_n < holes_count; hole_n++)
+                for (int n = 0; n < hole_points; n++)
+                {
+                    const float a = n * 6.2831853f / hole_points;
+                    const float r = 22.0f + sinf(a * 5.0f) * 6.0f + sinf(a * 53.0f) * 1.5f;
+                    points.push_back(ImVec2(center.x + (hole_n ? -35.0f : 35.0f) + cosf(a) * r, center.y + sinf(a) * r));
+                }
+            contours.push_back(1 + holes_count); // Contours count, followed by points count of each contour
+            contours.push_back(outline_points);
+            for (int hole_n = 0; hole_n < holes_count; hole_n++)
+                contours.push_back(hole_points);
+        }
+
+    for (int shape_n = 0, point_n = 0, contour_n = 0; shape_n < shape_count; shape_n++)
+    {
+        const int contours_count = contours[contour_n];
+        const int* contours_points_count = &contours[contour_n + 1];
+        draw_list->AddConcavePolyFilled(&points[point_n], contours_points_count, contours_count, IM_COL32(60 + shape_n * 15, 160, 90, 255));
+        for (int n = 0; n < contours_count; n++)
+            point_n += contours_points_count[n];
+        contour_n += 1 + contours_count;
+    }
+    ImGui::End();
+}
+
+// Heatmap/timeline style shapes, submitted one by one or using the batch API. Output is identical.
+struct BenchShapes
+{
+    ImVector<ImVec2>    RectMin, RectMax, LineP1, LineP2, CircleCenters;
+    ImVector<float>     CircleRadii;
+    ImVector<ImU32>     RectCols, LineCols, CircleCols;
+};
+
+static const BenchShapes& BenchGetShapes()
+{
+    static BenchShapes shapes;
+    if (!shapes.RectMin.empty())
+        return shapes;
+    for (int y = 0; y < 160; y++) // 160x250 heatmap cells
+        for (int x = 0; x < 250; x++)
+        {
+            shapes.RectMin.push_back(ImVec2(10.0f + x * 7.0f, 10.0f + y * 6.0f));
+            shapes.RectMax.push_back(ImVec2(10.0f + x * 7.0f + 6.0f, 10.0f + y * 6.0f + 5.0f));
+            shapes.RectCols.push_back(IM_COL32((x * 5) & 255, (y * 3) & 255, 128, 255));
+        }
+    for (int n = 0; n < 10000; n++) // Timeline markers
+    {
+        const float x = 10.0f + (float)((n * 37) % 1800);
+        const float y = 10.0f + (float)((n * 91) % 1000);
+        shapes.LineP1.push_back(ImVec2(x, y));
+        shapes.LineP2.push_back(ImVec2(x + 3.0f, y + 20.0f));
+        shapes.LineCols.push_back(IM_COL32(255, 255, (n * 7) & 255, 255));
+    }
+    for (int n = 0; n < 5000; n++) // Scatter plot
+    {
+        shapes.CircleCenters.push_back(ImVec2(10.0f + (float)((n * 53) % 1800), 10.0f + (float)((n * 29) % 1000)));
+        shapes.CircleRadii.push_back(2.0f + (float)(n % 5));
+        shapes.CircleCols.push_back(IM_COL32(0, 160, 255, 200));
+    }
+    return shapes;
+}
+
+static void Workload_Shapes(int frame)
+{
+    IM_UNUSED(frame);
+    const BenchShapes& shapes = BenchGetShapes();
+    BenchBeginFullscreenWindow("Shapes");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    for (int n = 0; n < shapes.RectMin.Size; n++)
+        draw_list->AddRectFilled(shapes.RectMin[n], shapes.RectMax[n], shapes.RectCols[n]);
+    for (int n = 0; n < shapes.LineP1.Size; n++)
+        draw_list->AddLine(shapes.LineP1[n], shapes.LineP2[n], shapes.LineCols[n], 1.0f);
+    for (int n = 0; n < shapes.CircleCenters.Size; n++)
+        draw_list->AddCircleFilled(shapes.CircleCenters[n], shapes.CircleRadii[n], shapes.CircleCols[n]);
+    ImGui::End();
+}
+
+static void Workload_ShapesBatch(int frame)
+{
+    IM_UNUSED(frame);
+    const BenchShapes& shapes = BenchGetShapes();
+    BenchBeginFullscreenWindow("Shapes");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    draw_list->AddRectFilledBatch(shapes.RectMin.Data, shapes.RectMax.Data, shapes.RectCols.Data, shapes.RectMin.Size);
+    draw_list->AddLineBatch(shapes.LineP1.Data, shapes.LineP2.Data, shapes.LineCols.Data, shapes.LineP1.Size, 1.0f);
+    draw_list->AddCircleFilledBatch(shapes.CircleCenters.Data, shapes.CircleRadii.Data, shapes.CircleCols.Data, shapes.CircleCenters.Size);
+    ImGui::End();
+}
+
+// Node editor style canvas: grid, wires and labels scrolling together. Submitted every frame, or recorded once into a ImDrawListFragment and appended with an offset.
+static void BenchCanvasContents(ImDrawList* draw_list, const ImVec2& origin)
+{
+    for (int n = 0; n <= 200; n++)
+        draw_list->AddLine(ImVec2(origin.x + n * 16.0f, origin.y), ImVec2(origin.x + n * 16.0f, origin.y + 1600.0f), IM_COL32(200, 200, 200, 40));
+    for (int n = 0; n <= 100; n++)
+        draw_list->AddLine(ImVec2(origin.x, origin.y + n * 16.0f), ImVec2(origin.x + 3200.0f, origin.y + n * 16.0f), IM_COL32(200, 200, 200, 40));
+    for (int n = 0; n < 400; n++)
+    {
+        ImVec2 p0(origin.x + (float)((n * 29) % 3000), origin.y + (float)((n * 61) % 1500));
+        draw_list->AddBezierCubic(p0, ImVec2(p0.x + 80, p0.y), ImVec2(p0.x + 120, p0.y + 90), ImVec2(p0.x + 200, p0.y + 90), IM_COL32(255, 200, 0, 255), 2.0f);
+    }
+    char label[32];
+    for (int n = 0; n < 1000; n++)
+    {
+        ImVec2 p0(origin.x + (float)((n * 43) % 3000), origin.y + (float)((n * 17) % 1500));
+        snprintf(label, IM_ARRAYSIZE(label), "Node %04d: Output", n);
+        draw_list->AddRectFilled(p0, ImVec2(p0.x + 130, p0.y + 18), IM_COL32(40, 40, 48, 255), 4.0f);
+        draw_list->AddText(ImVec2(p0.x + 4, p0.y + 2), IM_COL32_WHITE, label);
+    }
+}
+
+static void Workload_Canvas(int frame)
+{
+    BenchBeginFullscreenWindow("Canvas");
+    const ImVec2 scrolling((float)-(frame % 400), (float)-(frame % 200));
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    BenchCanvasContents(ImGui::GetWindowDrawList(), ImVec2(origin.x + scrolling.x, origin.y + scrolling.y));
+    ImGui::End();
+}
+
+static void Workload_CanvasCached(int frame)
+{
+    static ImDrawListFragment fragment;
+    if (frame == 0)
+        fragment.Clear(); // Each workload runs in a new context
+    BenchBeginFullscreenWindow("Canvas");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 scrolling((float)-(frame % 400), (float)-(frame % 200));
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    if (fragment.IsValid(draw_list))
+    {
+        draw_list->AddFragment(fragment, scrolling);
+    }
+    else
+    {
+        // Record unscrolled and unclipped, so any part may be revealed when appending
+        draw_list->PushClipRectFullScreen();
+        draw_list->FragmentBegin(&fragment);
+        BenchCanvasContents(draw_list, origin);
+        draw_list->FragmentEnd(&fragment);
+        draw_list->PopClipRect();
+    }
+    ImGui::End();
+}
+
+// Table of 5k static labels: names, wrapped descriptions and status. Clipped rows are still measured every frame (no clipper).
+static void Workload_Labels(int frame)
+{
+    static char names[5000][48];
+    static const char* descriptions[] =
+    {
+        "Diffuse texture for the rock formations, tiled every four meters along the canyon walls.",
+        "Normal map baked from the high resolution sculpt, used by all terrain materials in the north sector.",
+        "Ambient loop played when the player enters the cave system, fades out after thirty seconds.",
+        "Placeholder mesh, to be replaced before the next milestone.",
+    };
+    static const char* statuses[] = { "Up to date", "Modified", "Missing", "Conflict" };
+    if (frame == 0)
+        for (int n = 0; n < IM_ARRAYSIZE(names); n++)
+            snprintf(names[n], IM_ARRAYSIZE(names[n]), "assets/environment/canyon/rock_%04d.png", n);
+    BenchBeginFullscreenWindow("Labels");
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("table", 3, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthFixed, 320.0f);
+        ImGui::TableSetupColumn("Description", ImGuiTableColumnFlags_WidthFixed, 360.0f);
+        ImGui::TableSetupColumn("Status", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableHeadersRow();
+        for (int row = 0; row < IM_ARRAYSIZE(names); row++)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(names[row]);
+            ImGui::TableNextColumn();
+            ImGui::TextWrapped("%s", descriptions[row % IM_ARRAYSIZE(descriptions)]);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(statuses[(row / 7) % IM_ARRAYSIZE(statuses)]);
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// CJK text. The default font doesn't have those glyphs: use '--font' to load one that does, otherwise this measures the fallback path.
+static void Workload_TextCJK(int frame)
+{
+    IM_UNUSED(frame);
+    static const char* lines[] =
+    {
+        "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe3\x81\xae\xe3\x83\x86\xe3\x82\xad\xe3\x82\xb9\xe3\x83\x88\xe3\x82\x92\xe8\xa1\xa8\xe7\xa4\xba\xe3\x81\x97\xe3\x81\xbe\xe3\x81\x99\xe3\x80\x82", // Japanese
+        "\xe8\xbf\x99\xe6\x98\xaf\xe4\xb8\x80\xe6\xae\xb5\xe4\xb8\xad\xe6\x96\x87\xe6\x96\x87\xe6\x9c\xac\xef\xbc\x8c\xe7\x94\xa8\xe4\xba\x8e\xe6\xb5\x8b\xe8\xaf\x95\xe6\x80\xa7\xe8\x83\xbd\xe3\x80\x82", // Simplified Chinese
+        "\xed\x95\x9c\xea\xb5\xad\xec\x96\xb4 \xed\x85\x8d\xec\x8a\xa4\xed\x8a\xb8 \xeb\xa0\x8c\xeb\x8d\x94\xeb\xa7\x81 \xed\x85\x8c\xec\x8a\xa4\xed\x8a\xb8\xec\x9e\x85\xeb\x8b\x88\xeb\x8b\xa4.", // Korean
+        "Mixed \xe6\xbc\xa2\xe5\xad\x97 and ASCII \xe3\x81\x8b\xe3\x81\xaa \xed\x95\x9c\xea\xb8\x80 text 0123456789",
+    };
+    BenchBeginFullscreenWindow("TextCJK");
+    for (int n = 0; n < 2000; n++)
+        ImGui::TextUnformatted(lines[n % IM_ARRAYSIZE(lines)]);
+    ImGui::PushTextWrapPos(400.0f);
+    for (int n = 0; n < 200; n++)
+        ImGui::TextWrapped("%s %s %s", lines[0], lines[1], lines[2]);
+    ImGui::PopTextWrapPos();
+    ImGui::End();
+}
+
+// Log viewer over ~8 MB of text, mostly ASCII with a few UTF-8 lines. Clipped lines are still measured every frame, for the horizontal scrollbar.
+static void Workload_Log(int frame)
+{
+    static ImGuiTextBuffer text;
+    if (text.empty())
+    {
+        const int line_count = 80000;
+        text.reserve(line_count * 110);
+        for (int n = 0; n < line_count; n++)
+        {
+            if ((n % 50) == 49)
+                text.appendf("[%06d] [warn] r\xc3\xa9sum\xc3\xa9 of \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e entries, caf\xc3\xa9 \xe2\x82\xac%d.%02d, see log #%d\n", n, n % 100, n % 97, n / 50);
+            else
+                text.appendf("[%06d] [info] worker %02d: processed request /api/v2/items/%08X in %d.%03d ms, status 200 OK\n", n, n % 16, n * 2654435761u, n % 13, n % 1000);
+        }
+    }
+    BenchBeginFullscreenWindow("Log");
+    ImGui::Text("%d bytes, %d characters", text.size(), ImTextCountCharsFromUtf8(text.begin(), text.end()));
+    ImGui::BeginChild("scrolling", ImVec2(0, 0), ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar);
+    if (frame < 2) // Content size is only known after the first frame
+        ImGui::SetScrollY(ImGui::GetTextLineHeight() * 40000);
+    ImGui::TextEx(text.begin(), text.end(), ImGuiTextFlags_None); // Unlike TextUnformatted(), doesn't pass ImGuiTextFlags_NoWidthForLargeClippedText
+    ImGui::EndChild();
+    ImGui::End();
+}
+
+// Text at the last 4 font sizes of a zoom animation: each frame bakes ~100 glyphs for one new size.
+static void Workload_FontSizes(int frame)
+{
+    BenchBeginFullscreenWindow("FontSizes");
+    for (int n = 0; n < 4; n++)
+    {
+        ImGui::PushFont(NULL, 10.0f + (float)((frame + 1000 - n) % 1000) * 0.125f);
+        ImGui::TextUnformatted(" !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~");
+        ImGui::TextUnformatted("The quick brown fox jumps over the lazy dog.");
+        ImGui::PopFont();
+    }
+    ImGui::End();
+}
+
+// Text at every font size so far, newest first, one new size per frame: glyphs are never discarded and the atlas keeps growing.
+static void Workload_FontGrowth(int frame)
+{
+    BenchBeginFullscreenWindow("FontGrowth");
+    const int sizes_count = (frame < 120) ? frame + 1 : 120;
+    for (int n = sizes_count - 1; n >= 0; n--)
+    {
+        ImGui::PushFont(NULL, 10.0f + (float)n * 0.5f);
+        ImGui::TextUnformatted(" !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~");
+        ImGui::PopFont();
+    }
+    ImGui::End();
+}
+
+static const BenchWorkload BenchWorkloads[] =
+{
+    { "demo",           "ShowDemoWindow()",                                     Workload_Demo },
+    { "table_10k",      "Table with 10k rows x 4 columns, no clipper",          Workload_Table10k },
+    { "table_wide",     "24 tables x 32 columns, frozen row/column, scrolling",  Workload_TableWide },
+    { "inputtext_huge", "Active InputTextMultiline() over ~2.9 MB of text",     Workload_InputTextHuge },
+    { "windows_2k",     "2000 top-level windows",                               Workload_Windows2k },
+    { "drawlist",       "Dense ImDrawList polylines/circles/curves/rects",      Workload_DrawList },
+    { "polyline",       "10 polylines x 16k points, textured and geometry AA",  Workload_Polyline },
+    { "concave",        "12 concave polygons x 4k points, some with holes",     Workload_Concave },
+    { "shapes",         "40k rects, 10k lines, 5k circles, one call per shape",  Workload_Shapes },
+    { "shapes_batch",   "Same as 'shapes' using AddXXXBatch() functions",       Workload_ShapesBatch },
+    { "canvas",         "Grid, 400 wires, 1000 labels, scrolling",              Workload_Canvas },
+    { "canvas_cached",  "Same as 'canvas' recorded once into a ImDrawListFragment", Workload_CanvasCached },
+    { "text_cjk",       "CJK text, plain and wrapped",                          Workload_TextCJK },
+    { "labels",         "Table with 5k rows of static labels, wrapped descriptions", Workload_Labels },
+    { "log",            "Log viewer over ~8 MB of text, scrolled to the middle", Workload_Log },
+    { "font_sizes",     "Text at 4 font sizes, one new size per frame",         Workload_FontSizes },
+    { "font_growth",    "Text at all font sizes so far, one new size per frame", Workload_FontGrowth },
+};
+
+//-----------------------------------------------------------------------------
+// Benchmark: runner
+//-----------------------------------------------------------------------------
+
+// Stand-in for mapped GPU buffers
+struct BenchUploadArena
+{
+    ImVector<ImDrawVert>    VtxBuffer;
+    ImVector<char>          IdxBuffer;
+};
+
+// Called by Render() with '--arena'
+static bool BenchGetDrawDataArena(ImGuiContext*, ImDrawData* draw_data, ImDrawVert** out_vtx_dst, void** out_idx_dst)
+{
+    BenchUploadArena* arena = (BenchUploadArena*)ImGui::GetPlatformIO().Renderer_DrawDataArenaUserData;
+    arena->VtxBuffer.resize(draw_data->TotalVtxCount);
+    arena->IdxBuffer.resize(draw_data->TotalIdxCount * draw_data->IdxSize);
+    *out_vtx_dst = arena->VtxBuffer.Data;
+    *out_idx_dst = arena->IdxBuffer.Data;
+    return true;
+}
+
+// Render target with '--softraster', dirty tiles with '--tiles'
+struct BenchImage
+{
+    ImVector<ImU32>             Pixels;
+    ImGui_ImplSoftRaster_Image  Image;
+    ImDrawDataTileTracker       Tiles;
+};
+
+static void BenchImageRender(BenchImage* image, ImDrawData* draw_data, bool dirty_tiles_only)
+{
+    const ImU32 clear_col = IM_COL32(0, 0, 0, 255);
+    const int w = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    const int h = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    image->Pixels.resize(w * h);
+    image->Image.Pixels = image->Pixels.Data;
+    image->Image.Width = w;
+    image->Image.Height = h;
+    image->Image.Pitch = w * 4;
+    if (dirty_tiles_only)
+    {
+        ImGui_ImplSoftRaster_RenderDrawDataTiles(draw_data, &image->Image, &image->Tiles, clear_col);
+        return;
+    }
+    for (ImU32& pixel : image->Pixels)
+        pixel = clear_col;
+    ImGui_ImplSoftRaster_RenderDrawData(draw_data, &image->Image);
+}
+
+// Write uncompressed 32-bit TGA
+static bool BenchImageSaveTga(const BenchImage* image, const char* filename)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+        return false;
+    const int w = image->Image.Width, h = image->Image.Height;
+    const unsigned char header[18] = { 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, (unsigned char)(w & 0xFF), (unsigned char)(w >> 8), (unsigned char)(h & 0xFF), (unsigned char)(h >> 8), 32, 0x28 }; // Top-left origin, 8-bit alpha
+    fwrite(header, 1, sizeof(header), f);
+    for (ImU32 col : image->Pixels)
+    {
+        const unsigned char bgra[4] = { (unsigned char)(col >> IM_COL32_B_SHIFT), (unsigned char)(col >> IM_COL32_G_SHIFT), (unsigned char)(col >> IM_COL32_R_SHIFT), (unsigned char)(col >> IM_COL32_A_SHIFT) };
+        fwrite(bgra, 1, 4, f);
+    }
+    fclose(f);
+    return true;
+}
+
+static ImU32 BenchHash(const void* data, size_t size, ImU32 hash)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t n = 0; n < size; n++)
+        hash = (hash ^ p[n]) * 16777619u; // FNV-1a
+    return hash;
+}
+
+// Hash triangles as a GPU would fetch them from the upload arena, along with their bounding box clipped by ClipRect
+// (merging draw commands may enlarge ClipRect when this has no visible effect).
+// Without '--arena', commands are relative to their draw list and we add list offsets like most backends do.
+static ImU32 BenchHashDrawData(const ImDrawData* draw_data, const BenchUploadArena* arena, ImU32 hash)
+{
+    const bool rebased = (draw_data->ArenaVtxBuffer != nullptr);
+    unsigned int list_vtx_offset = 0, list_idx_offset = 0;
+    ImVec4 bb;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            if (cmd.UserCallback != nullptr)
+                continue;
+            const ImDrawVert* vtx_buffer = arena->VtxBuffer.Data + (rebased ? 0 : list_vtx_offset) + cmd.VtxOffset;
+            const char* idx_buffer = arena->IdxBuffer.Data + (size_t)((rebased ? 0 : list_idx_offset) + cmd.IdxOffset) * draw_data->IdxSize;
+            for (unsigned int n = 0; n < cmd.ElemCount; n++)
+            {
+                const unsigned int idx = (draw_data->IdxSize == 2) ? ((const ImU16*)(const void*)idx_buffer)[n] : ((const ImU32*)(const void*)idx_buffer)[n];
+                const ImDrawVert& v = vtx_buffer[idx];
+                hash = BenchHash(&v, sizeof(ImDrawVert), hash);
+                if (n % 3 == 0)
+                    bb = ImVec4(v.pos.x, v.pos.y, v.pos.x, v.pos.y);
+                bb = ImVec4(fminf(bb.x, v.pos.x), fminf(bb.y, v.pos.y), fmaxf(bb.z, v.pos.x), fmaxf(bb.w, v.pos.y));
+                if (n % 3 == 2)
+                {
+                    ImVec4 clipped_bb(fmaxf(bb.x, cmd.ClipRect.x), fmaxf(bb.y, cmd.ClipRect.y), fminf(bb.z, cmd.ClipRect.z), fminf(bb.w, cmd.ClipRect.w));
+                    hash = BenchHash(&clipped_bb, sizeof(clipped_bb), hash);
+                }
+            }
+        }
+        list_vtx_offset += draw_list->VtxBuffer.Size;
+        list_idx_offset += draw_list->IdxBuffer.Size;
+    }
+    return hash;
+}
+
+static void BenchRenderFrame(const BenchWorkload& workload, int frame, const BenchConfig& config, BenchUploadArena* arena, BenchImage* image, BenchResult* result, bool record)
+{
+    BenchClock::time_point t[BenchPhase_COUNT + 1];
+    const int allocs_count_before = g_BenchAllocs.AllocCount;
+    const size_t allocs_bytes_before = g_BenchAllocs.AllocBytes;
+
+    t[0] = BenchClock::now();
+    ImGui_ImplNullPlatform_NewFrame();
+    if (config.SoftRaster)
+        ImGui_ImplSoftRaster_NewFrame();
+    else
+        ImGui_ImplNullRender_NewFrame();
+    ImGui::NewFrame();
+    t[1] = BenchClock::now();
+    workload.Frame(frame);
+    t[2] = BenchClock::now();
+    ImGui::Render();
+    t[3] = BenchClock::now();
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    const bool skip_render = config.SkipUnchanged && draw_data->Unchanged; // Keep previous image and upload arena contents
+    if (!skip_render)
+    {
+        if (config.DirtyTiles)
+            image->Tiles.Update(draw_data);
+        if (config.SoftRaster)
+            BenchImageRender(image, draw_data, config.DirtyTiles);
+        else
+            ImGui_ImplNullRender_RenderDrawData(draw_data);
+        if (draw_data->ArenaVtxBuffer == nullptr)
+        {
+            arena->VtxBuffer.resize(draw_data->TotalVtxCount);
+            arena->IdxBuffer.resize(draw_data->TotalIdxCount * draw_data->IdxSize);
+            draw_data->CopyAllBuffers(arena->VtxBuffer.Data, arena->IdxBuffer.Data);
+        }
+    }
+    t[4] = BenchClock::now();
+
+    if (!record)
+        return;
+    if (config.Checksum)
+        result->Checksum = BenchHashDrawData(draw_data, arena, result->Checksum);
+    if (config.Checksum && config.SoftRaster)
+        result->Checksum = BenchHash(image->Pixels.Data, (size_t)image->Pixels.size_in_bytes(), result->Checksum);
+    for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+        result->PhaseMs[phase].Add(BenchElapsedMs(t[phase], t[phase + 1]));
+    result->FrameMs.Add(BenchElapsedMs(t[0], t[BenchPhase_COUNT]));
+    result->Allocs.Add((double)(g_BenchAllocs.AllocCount - allocs_count_before));
+    result->AllocBytes.Add((double)(g_BenchAllocs.AllocBytes - allocs_bytes_before));
+
+    int cmd_count = 0;
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+        cmd_count += draw_list->CmdBuffer.Size;
+    result->VtxCount.Add((double)draw_data->TotalVtxCount);
+    result->IdxCount.Add((double)draw_data->TotalIdxCount);
+    result->CmdCount.Add((double)cmd_count);
+    result->ListCount.Add((double)draw_data->CmdListsCount);
+    if (config.DirtyTiles)
+        result->DirtyTilesPercent.Add((image->Tiles.TileHashes.Size > 0 && !skip_render) ? image->Tiles.DirtyTiles.Size * 100.0 / image->Tiles.TileHashes.Size : 0.0);
+    if (config.SkipUnchanged)
+        result->UnchangedPercent.Add(skip_render ? 100.0 : 0.0);
+}
+
+// Each workload runs in a fresh context so results don't depend on which workloads ran before.
+static void BenchRunWorkload(const BenchWorkload& workload, const BenchConfig& config, BenchResult* result)
+{
+    const BenchClock::time_point startup_t0 = BenchClock::now();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    if (config.FontFilename != NULL && io.Fonts->AddFontFromFileTTF(config.FontFilename) == NULL)
+        fprintf(stderr, "Failed to load font '%s', using default font.\n", config.FontFilename);
+    char font_cache_filename[512] = "";
+    if (config.FontCachePrefix != NULL)
+    {
+        snprintf(font_cache_filename, IM_ARRAYSIZE(font_cache_filename), "%s%s.bin", config.FontCachePrefix, workload.Name);
+        io.Fonts->LoadCacheFromFile(font_cache_filename); // Fails on first run
+    }
+    ImGui_ImplNullPlatform_Init();
+    if (config.SoftRaster)
+        ImGui_ImplSoftRaster_Init();
+    else
+        ImGui_ImplNullRender_Init();
+    BenchThreadPool* pool = (config.ThreadsCount > 1) ? new BenchThreadPool() : nullptr;
+    if (pool)
+        BenchThreadPoolStart(pool, config.ThreadsCount);
+
+    BenchUploadArena* arena = new BenchUploadArena(); // Freed before DestroyContext(), its buffers use our allocator.
+    BenchImage* image = new BenchImage();
+    io.ConfigRenderMergeDrawLists = config.MergeDrawLists;
+    io.ConfigRenderDetectUnchangedFrames = config.SkipUnchanged;
+    io.ConfigTextLayoutCache = config.TextLayoutCache;
+    ImGui::GetStyle().AntiAliasedFillUseTex = config.FillUseTex;
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    if (config.UseArena)
+    {
+        platform_io.Renderer_GetDrawDataArenaFn = BenchGetDrawDataArena;
+        platform_io.Renderer_DrawDataArenaUserData = arena;
+    }
+    if (config.AsyncGlyphs)
+    {
+        io.Fonts->Flags |= ImFontAtlasFlags_AsyncGlyphLoad;
+        platform_io.Platform_AsyncJobStartFn = BenchAsyncJobStart;
+        platform_io.Platform_AsyncJobWaitFn = BenchAsyncJobWait;
+    }
+    if (config.MultiPage)
+        io.Fonts->Flags |= ImFontAtlasFlags_MultiPage;
+    for (int n = 0; n < config.WarmupFrames + config.Frames; n++)
+    {
+        BenchRenderFrame(workload, n, config, arena, image, result, n >= config.WarmupFrames);
+        if (n == 0)
+            result->StartupMs = BenchElapsedMs(startup_t0, BenchClock::now());
+    }
+    if (font_cache_filename[0] != 0 && !io.Fonts->SaveCacheToFile(font_cache_filename))
+        fprintf(stderr, "Failed to write '%s'.\n", font_cache_filename);
+    platform_io.Renderer_GetDrawDataArenaFn = nullptr;
+    platform_io.Renderer_DrawDataArenaUserData = nullptr;
+    delete arena;
+    if (config.SaveTgaPrefix != NULL)
+    {
+        char filename[512];
+        snprintf(filename, IM_ARRAYSIZE(filename), "%s%s.tga", config.SaveTgaPrefix, workload.Name);
+        if (!BenchImageSaveTga(image, filename))
+            fprintf(stderr, "Failed to write '%s'.\n", filename);
+    }
+    delete image;
+
+    if (pool)
+    {
+        BenchThreadPoolStop(pool);
+        delete pool;
+    }
+    if (config.SoftRaster)
+        ImGui_ImplSoftRaster_Shutdown();
+    else
+        ImGui_ImplNullRender_Shutdown();
+    ImGui_ImplNullPlatform_Shutdown();
+    ImGui::DestroyContext();
+}
+
+static void BenchPrintResult(const BenchWorkload& workload, const BenchConfig& config, const BenchResult& r, bool csv)
+{
+    if (csv)
+    {
+        printf("%s", workload.Name);
+        for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+            printf(",%.4f", r.PhaseMs[phase].Avg());
+        printf(",%.4f,%.4f,%.4f,%.1f,%.0f,%.0f,%.0f,%.0f,%.0f", r.FrameMs.Avg(), r.FrameMs.Min, r.FrameMs.Max,
+            r.Allocs.Avg(), r.AllocBytes.Avg(), r.VtxCount.Avg(), r.IdxCount.Avg(), r.CmdCount.Avg(), r.ListCount.Avg());
+        if (config.DirtyTiles)
+            printf(",%.1f", r.DirtyTilesPercent.Avg());
+        if (config.SkipUnchanged)
+            printf(",%.1f", r.UnchangedPercent.Avg());
+        if (config.FontCachePrefix)
+            printf(",%.3f", r.StartupMs);
+        if (config.Checksum)
+            printf(",%08X", r.Checksum);
+        printf("\n");
+        return;
+    }
+    printf("%-16s", workload.Name);
+    for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+        printf(" %9.3f", r.PhaseMs[phase].Avg());
+    printf(" %9.3f %9.3f %9.3f %8.1f %10.0f %8.0f %8.0f %6.0f %5.0f", r.FrameMs.Avg(), r.FrameMs.Min, r.FrameMs.Max,
+        r.Allocs.Avg(), r.AllocBytes.Avg(), r.VtxCount.Avg(), r.IdxCount.Avg(), r.CmdCount.Avg(), r.ListCount.Avg());
+    if (config.DirtyTiles)
+        printf(" %6.1f", r.DirtyTilesPercent.Avg());
+    if (config.SkipUnchanged)
+        printf(" %6.1f", r.UnchangedPercent.Avg());
+    if (config.FontCachePrefix)
+        printf(" %10.3f", r.StartupMs);
+    if (config.Checksum)
+        printf(" %08X", r.Checksum);
+    printf("\n");
+}
+
+static int BenchMain(int argc, char** argv)
+{
+    BenchConfig config;
+    bool csv = false;
+    ImVector<const BenchWorkload*> selected;
+    for (int arg_n = 1; arg_n < argc; arg_n++)
+    {
+        const char* arg = argv[arg_n];
+        if (strcmp(arg, "--bench") == 0)
+            continue;
+        if (strcmp(arg, "--frames") == 0 && arg_n + 1 < argc)
+            config.Frames = atoi(argv[++arg_n]);
+        else if (strcmp(arg, "--warmup") == 0 && arg_n + 1 < argc)
+            config.WarmupFrames = atoi(argv[++arg_n]);
+        else if (strcmp(arg, "--threads") == 0 && arg_n + 1 < argc)
+            config.ThreadsCount = atoi(argv[++arg_n]);
+        else if (strcmp(arg, "--arena") == 0)
+            config.UseArena = true;
+        else if (strcmp(arg, "--merge") == 0)
+            config.MergeDrawLists = true;
+        else if (strcmp(arg, "--softraster") == 0)
+            config.SoftRaster = true;
+        else if (strcmp(arg, "--save-tga") == 0 && arg_n + 1 < argc)
+            config.SaveTgaPrefix = argv[++arg_n];
+        else if (strcmp(arg, "--tiles") == 0)
+            config.DirtyTiles = true;
+        else if (strcmp(arg, "--skip-unchanged") == 0)
+            config.SkipUnchanged = true;
+        else if (strcmp(arg, "--fill-tex") == 0)
+            config.FillUseTex = true;
+        else if (strcmp(arg, "--text-cache") == 0)
+            config.TextLayoutCache = true;
+        else if (strcmp(arg, "--async-glyphs") == 0)
+            config.AsyncGlyphs = true;
+        else if (strcmp(arg, "--multi-page") == 0)
+            config.MultiPage = true;
+        else if (strcmp(arg, "--checksum") == 0)
+            config.Checksum = true;
+        else if (strcmp(arg, "--font") == 0 && arg_n + 1 < argc)
+            config.FontFilename = argv[++arg_n];
+        else if (strcmp(arg, "--font-cache") == 0 && arg_n + 1 < argc)
+            config.FontCachePrefix = argv[++arg_n];
+        else if (strcmp(arg, "--csv") == 0)
+            csv = true;
+        else
+        {
+            const BenchWorkload* workload = NULL;
+            for (const BenchWorkload& candidate : BenchWorkloads)
+                if (strcmp(candidate.Name, arg) == 0)
+                    workload = &candidate;
+            if (workload == NULL)
+            {
+                fprintf(stderr, "Unknown argument or workload '%s'. Available workloads:\n", arg);
+                for (const BenchWorkload& candidate : BenchWorkloads)
+                    fprintf(stderr, "  %-16s %s\n", candidate.Name, candidate.Desc);
+                return 1;
+            }
+            selected.push_back(workload);
+        }
+    }
+    if (config.Frames < 1)
+        config.Frames = 1;
+    if (config.WarmupFrames < 0)
+        config.WarmupFrames = 0;
+    if (config.SaveTgaPrefix != NULL)
+        config.SoftRaster = true;
+    if (selected.empty())
+        for (const BenchWorkload& workload : BenchWorkloads)
+            selected.push_back(&workload);
+
+    ImGui::SetAllocatorFunctions(BenchMallocWrapper, BenchFreeWrapper, &g_BenchAllocs);
+
+    if (csv)
+    {
+        printf("workload");
+        for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+            printf(",%s_ms", BenchPhaseNames[phase]);
+        printf(",frame_ms,frame_min_ms,frame_max_ms,allocs,alloc_bytes,vtx,idx,cmds,lists%s%s%s%s\n", config.DirtyTiles ? ",dirty_tiles_pct" : "", config.SkipUnchanged ? ",unchanged_pct" : "", config.FontCachePrefix ? ",startup_ms" : "", config.Checksum ? ",checksum" : "");
+    }
+    else
+    {
+        printf("dear imgui %s, %d frames (+%d warm-up), %d thread(s)%s%s%s%s%s%s%s, averages per frame:\n", IMGUI_VERSION, config.Frames, config.WarmupFrames, config.ThreadsCount, config.UseArena ? ", arena" : "", config.MergeDrawLists ? ", merge" : "", config.SoftRaster ? ", softraster" : "", config.FillUseTex ? ", fill-tex" : "", config.TextLayoutCache ? ", text-cache" : "", config.AsyncGlyphs ? ", async-glyphs" : "", config.MultiPage ? ", multi-page" : "");
+        printf("%-16s", "workload");
+        for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+            printf(" %9.9s", BenchPhaseNames[phase]);
+        printf(" %9s %9s %9s %8s %10s %8s %8s %6s %5s%s%s%s%s\n", "frame_ms", "min_ms", "max_ms", "allocs", "bytes", "vtx", "idx", "cmds", "lists", config.DirtyTiles ? " dirty%" : "", config.SkipUnchanged ? "  same%" : "", config.FontCachePrefix ? " startup_ms" : "", config.Checksum ? " checksum" : "");
+    }
+    for (const BenchWorkload* workload : selected)
+    {
+        BenchResult result;
+        BenchRunWorkload(*workload, config, &result);
+        BenchPrintResult(*workload, config, result, csv);
+    }
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int argc, char** argv)
 {
     IMGUI_CHECKVERSION();
 
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0)
+        return BenchMain(argc, argv);
+
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
 
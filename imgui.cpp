@@ -97,6 +97,7 @@ CODE
 // [SECTION] PLATFORM DEPENDENT HELPERS
 // [SECTION] METRICS/DEBUGGER WINDOW
 // [SECTION] DEBUG LOG WINDOW
+// [SECTION] DEBUG PROFILER
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, ID STACK TOOL)
 
 */
@@ -1285,6 +1286,7 @@ static const char*      Platform_GetClipboardTextFn_DefaultImpl(ImGuiContext* ct
 static void             Platform_SetClipboardTextFn_DefaultImpl(ImGuiContext* ctx, const char* text);
 static void             Platform_SetImeDataFn_DefaultImpl(ImGuiContext* ctx, ImGuiViewport* viewport, ImGuiPlatformImeData* data);
 static bool             Platform_OpenInShellFn_DefaultImpl(ImGuiContext* ctx, const char* path);
+static ImU64            Platform_GetTimeNsFn_DefaultImpl(ImGuiContext* ctx);
 
 namespace ImGui
 {
@@ -1337,6 +1339,7 @@ static void             UpdateFontsNewFrame();
 static void             UpdateFontsEndFrame();
 static void             UpdateTexturesNewFrame();
 static void             UpdateTexturesEndFrame();
+static void             UpdateNextFrameDeadline();
 static void             UpdateSettings();
 static int              UpdateWindowManualResize(ImGuiWindow* window, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
@@ -1395,6 +1398,12 @@ static ImGuiMemAllocFunc    GImAllocatorAllocFunc = MallocWrapper;
 static ImGuiMemFreeFunc     GImAllocatorFreeFunc = FreeWrapper;
 static void*                GImAllocatorUserData = NULL;
 
+// [DEBUG] Identify the current thread: MemAlloc()/MemFree() only record allocations in the context from the thread running it.
+// Draw lists may be filled from worker threads (see AddWindowDrawList()), updating ImGuiDebugAllocInfo from there would be a data race.
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+static thread_local char    GImDebugAllocThreadTag = 0;
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO, ImGuiPlatformIO)
 //-----------------------------------------------------------------------------
@@ -1462,6 +1471,7 @@ ImGuiStyle::ImGuiStyle()
     AntiAliasedLines            = true;             // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU.
     AntiAliasedLinesUseTex      = true;             // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     AntiAliasedFill             = true;             // Enable anti-aliased filled shapes (rounded rectangles, circles, etc.).
+    AntiAliasedFillUseTex       = false;            // Enable anti-aliased filled rounded rectangles and circles using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     CurveTessellationTol        = 1.25f;            // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     CircleTessellationMaxError  = 0.30f;            // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
 
@@ -1572,6 +1582,9 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigRenderMergeDrawLists = false;
+    ConfigRenderDetectUnchangedFrames = false;
+    ConfigTextLayoutCache = false;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugHighlightIdConflictsShowItemPicker = true;
@@ -2554,12 +2567,69 @@ int ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char*
     return wanted;
 }
 
+// Find the end of a run of ASCII characters, to let callers process them without decoding.
+// - Stops at first byte < min_c or >= 0x80. Use min_c = 1 to only stop at zero-terminator and multi-byte UTF-8 sequences, min_c = 32 to also stop at control characters such as '\n'.
+// - Bytes >= 0x80 are negative when read as signed char, so a single signed comparison against min_c catches both cases.
+// - Requires a valid in_text_end: we read in blocks and never past in_text_end.
+const char* ImTextFindNonAscii(const char* in_text, const char* in_text_end, unsigned int min_c)
+{
+    IM_ASSERT(min_c >= 1 && min_c < 0x80);
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128i v_min = _mm_set1_epi8((char)min_c);
+    for (; in_text_end - in_text >= 32; in_text += 32)
+    {
+        const __m128i v_lt0 = _mm_cmplt_epi8(_mm_loadu_si128((const __m128i*)(const void*)in_text), v_min);
+        const __m128i v_lt1 = _mm_cmplt_epi8(_mm_loadu_si128((const __m128i*)(const void*)(in_text + 16)), v_min);
+        if (_mm_movemask_epi8(_mm_or_si128(v_lt0, v_lt1)) != 0)
+            break;
+    }
+    for (; in_text_end - in_text >= 16; in_text += 16)
+        if (_mm_movemask_epi8(_mm_cmplt_epi8(_mm_loadu_si128((const __m128i*)(const void*)in_text), v_min)) != 0)
+            break;
+#elif defined(IMGUI_ENABLE_NEON)
+    const int8x16_t v_min = vdupq_n_s8((int8_t)min_c);
+    for (; in_text_end - in_text >= 32; in_text += 32)
+    {
+        const uint8x16_t v_lt0 = vcltq_s8(vld1q_s8((const int8_t*)in_text), v_min);
+        const uint8x16_t v_lt1 = vcltq_s8(vld1q_s8((const int8_t*)(in_text + 16)), v_min);
+        if (vmaxvq_u8(vorrq_u8(v_lt0, v_lt1)) != 0)
+            break;
+    }
+    for (; in_text_end - in_text >= 16; in_text += 16)
+        if (vmaxvq_u8(vcltq_s8(vld1q_s8((const int8_t*)in_text), v_min)) != 0)
+            break;
+#else
+    // Portable version, 8 bytes at a time. A byte < min_c borrows into its top bit, a byte >= 0x80 already has it set.
+    // Borrows may only create false positives above a true positive, which the scalar loop below takes care of.
+    const ImU64 ones = (ImU64)-1 / 255;
+    for (; in_text_end - in_text >= 8; in_text += 8)
+    {
+        ImU64 v;
+        memcpy(&v, in_text, 8);
+        if (((v - ones * min_c) | v) & (ones * 0x80))
+            break;
+    }
+#endif
+    // Locate the exact byte in the last block, or process remaining bytes.
+    while (in_text < in_text_end && (signed char)*in_text >= (signed char)min_c)
+        in_text++;
+    return in_text;
+}
+
 int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining)
 {
     ImWchar* buf_out = buf;
     ImWchar* buf_end = buf + buf_size;
     while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
     {
+        // Fast path: copy runs of ASCII characters without decoding them
+        if (in_text_end != NULL && (unsigned char)*in_text < 0x80)
+        {
+            const char* run_end = ImTextFindNonAscii(in_text, ImMin(in_text_end, in_text + (buf_end - 1 - buf_out)));
+            while (in_text < run_end)
+                *buf_out++ = (ImWchar)(unsigned char)*in_text++;
+            continue;
+        }
         unsigned int c;
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         *buf_out++ = (ImWchar)c;
@@ -2575,6 +2645,14 @@ int ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
     int char_count = 0;
     while ((!in_text_end || in_text < in_text_end) && *in_text)
     {
+        // Fast path: count runs of ASCII characters without decoding them
+        if (in_text_end != NULL && (unsigned char)*in_text < 0x80)
+        {
+            const char* run_end = ImTextFindNonAscii(in_text, in_text_end);
+            char_count += (int)(run_end - in_text);
+            in_text = run_end;
+            continue;
+        }
         unsigned int c;
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         char_count++;
@@ -3983,6 +4061,7 @@ void ImGui::RenderMouseCursor(ImVec2 base_pos, float base_scale, ImGuiMouseCurso
             float a_max = a_min + IM_PI * 1.65f;
             draw_list->PathArcTo(pos + ImVec2(14, -1) * scale, 6.0f * scale, a_min, a_max);
             draw_list->PathStroke(col_fill, ImDrawFlags_None, 3.0f * scale);
+            RequestNextFrame();
         }
         draw_list->PopTexture();
     }
@@ -4027,6 +4106,9 @@ ImGuiContext* ImGui::CreateContext(ImFontAtlas* shared_font_atlas)
 {
     ImGuiContext* prev_ctx = GetCurrentContext();
     ImGuiContext* ctx = IM_NEW(ImGuiContext)(shared_font_atlas);
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    ctx->DebugAllocInfo.OwnerThreadTag = &GImDebugAllocThreadTag;
+#endif
     SetCurrentContext(ctx);
     Initialize();
     if (prev_ctx != NULL)
@@ -4283,6 +4365,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     FramerateSecPerFrameIdx = FramerateSecPerFrameCount = 0;
     FramerateSecPerFrameAccum = 0.0f;
     WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
+    NextFrameDeadline = 0.0;
     memset(TempKeychordName, 0, sizeof(TempKeychordName));
 }
 
@@ -4318,6 +4401,7 @@ void ImGui::Initialize()
     g.PlatformIO.Platform_SetClipboardTextFn = Platform_SetClipboardTextFn_DefaultImpl;
     g.PlatformIO.Platform_OpenInShellFn = Platform_OpenInShellFn_DefaultImpl;
     g.PlatformIO.Platform_SetImeDataFn = Platform_SetImeDataFn_DefaultImpl;
+    g.PlatformIO.Platform_GetTimeNsFn = Platform_GetTimeNsFn_DefaultImpl;
 
     // Create default viewport
     ImGuiViewportP* viewport = IM_NEW(ImGuiViewportP)();
@@ -4358,9 +4442,14 @@ void ImGui::Shutdown()
     IM_ASSERT_USER_ERROR(g.IO.BackendPlatformUserData == NULL, "Forgot to shutdown Platform backend?");
     IM_ASSERT_USER_ERROR(g.IO.BackendRendererUserData == NULL, "Forgot to shutdown Renderer backend?");
 
+    // Text layouts refer to fonts
+    g.TextLayoutCache.Clear();
+    g.DrawListSharedData.TextLayoutCache = NULL;
+
     // The fonts atlas can be used prior to calling NewFrame(), so we clear it even if g.Initialized is FALSE (which would happen if we never called NewFrame)
     for (ImFontAtlas* atlas : g.FontAtlases)
     {
+        ImFontAtlasBuildCommitAsyncGlyphs(atlas, true); // Jobs may have been started with our platform_io hooks
         UnregisterFontAtlas(atlas);
         if (atlas->RefCount == 0)
         {
@@ -4411,7 +4500,7 @@ void ImGui::Shutdown()
 
     g.Tables.Clear();
     g.TablesTempData.clear_destruct();
-    g.DrawChannelsTempMergeBuffer.clear();
+    g.DrawChannelsTempMergeOrder.clear();
 
     g.MultiSelectStorage.Clear();
     g.MultiSelectTempData.clear_destruct();
@@ -4436,6 +4525,12 @@ void ImGui::Shutdown()
     g.LogBuffer.clear();
     g.DebugLogBuf.clear();
     g.DebugLogIndex.clear();
+    for (ImGuiDebugProfilerFrame& profiler_frame : g.DebugProfiler.Frames)
+    {
+        profiler_frame.Scopes.clear();
+        profiler_frame.NamesBuf.clear();
+    }
+    g.DebugProfiler.ScopeStack.clear();
 
     g.Initialized = false;
 }
@@ -4538,6 +4633,7 @@ void ImGui::GcCompactTransientMiscBuffers()
     g.InputTextLineIndex.clear();
     g.MultiSelectTempDataStacked = 0;
     g.MultiSelectTempData.clear_destruct();
+    g.TextLayoutCache.Clear();
     TableGcCompactSettings();
     for (ImFontAtlas* atlas : g.FontAtlases)
         atlas->CompactCache();
@@ -4554,6 +4650,7 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
     window->IDStack.clear();
     window->DrawList->_ClearFreeMemory();
+    window->DrawListsExtra.clear();
     window->DC.ChildWindows.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
@@ -4813,10 +4910,16 @@ bool ImGui::IsItemHovered(ImGuiHoveredFlags flags)
         // but once unlocked on a given item we also moving.
         //if (g.HoverDelayTimer >= delay && (g.HoverDelayTimer - g.IO.DeltaTime < delay || g.MouseStationaryTimer - g.IO.DeltaTime < g.Style.HoverStationaryDelay)) { IMGUI_DEBUG_LOG("HoverDelayTimer = %f/%f, MouseStationaryTimer = %f\n", g.HoverDelayTimer, delay, g.MouseStationaryTimer); }
         if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverItemUnlockedStationaryId != hover_delay_id)
+        {
+            RequestNextFrame(g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
             return false;
+        }
 
         if (g.HoverItemDelayTimer < delay)
+        {
+            RequestNextFrame(delay - g.HoverItemDelayTimer);
             return false;
+        }
     }
 
     return true;
@@ -4985,7 +5088,8 @@ void* ImGui::MemAlloc(size_t size)
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ImGuiContext* ctx = GImGui)
-        DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+        if (ctx->DebugAllocInfo.OwnerThreadTag == &GImDebugAllocThreadTag)
+            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
 #endif
     return ptr;
 }
@@ -4996,7 +5100,8 @@ void ImGui::MemFree(void* ptr)
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ptr != NULL)
         if (ImGuiContext* ctx = GImGui)
-            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
+            if (ctx->DebugAllocInfo.OwnerThreadTag == &GImDebugAllocThreadTag)
+                DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
 #endif
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
@@ -5018,6 +5123,13 @@ void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr
         //printf("[%05d] MemAlloc(%d) -> 0x%p\n", frame_count, (int)size, ptr);
         entry->AllocCount++;
         info->TotalAllocCount++;
+        if (info->SteadyStateStartFrame >= 0 && frame_count >= info->SteadyStateStartFrame)
+        {
+            info->SteadyStateAllocCount++;
+            info->SteadyStateAllocBytes += size;
+            info->SteadyStateLastAllocFrame = frame_count;
+            IM_ASSERT(!info->SteadyStateAssert && "MemAlloc() called in steady state. Disable with DebugAllocSteadyStateEnd().");
+        }
     }
     else
     {
@@ -5027,6 +5139,24 @@ void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr
     }
 }
 
+void ImGui::DebugAllocSteadyStateBegin(bool assert_on_alloc)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
+    info->SteadyStateStartFrame = g.FrameCount + 1;
+    info->SteadyStateAllocCount = 0;
+    info->SteadyStateAllocBytes = 0;
+    info->SteadyStateLastAllocFrame = -1;
+    info->SteadyStateAssert = assert_on_alloc;
+}
+
+void ImGui::DebugAllocSteadyStateEnd()
+{
+    ImGuiContext& g = *GImGui;
+    g.DebugAllocInfo.SteadyStateStartFrame = -1;
+    g.DebugAllocInfo.SteadyStateAssert = false;
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -5089,6 +5219,14 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+// Applications using io.NextFrameDeadline to sleep won't refresh unless inputs are received or something requests a frame.
+// Widgets running animations or waiting for timers call this every frame they need to be refreshed.
+void ImGui::RequestNextFrame(float delay)
+{
+    ImGuiContext& g = *GImGui;
+    g.NextFrameDeadline = ImMin(g.NextFrameDeadline, g.Time + ImMax(delay, 0.0f));
+}
+
 static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
     // Create the draw list on demand, because they are not frequently used for all viewports
@@ -5140,6 +5278,85 @@ ImDrawListSharedData* ImGui::GetDrawListSharedData()
     return &GImGui->DrawListSharedData;
 }
 
+// Shared data for draw lists filled by worker threads. Not registered into the font atlas: UpdateDrawListSharedData() refreshes texture coordinates instead.
+ImDrawListSharedData* ImGui::CreateDrawListSharedData()
+{
+    ImDrawListSharedData* data = IM_NEW(ImDrawListSharedData)();
+    if (GImGui != NULL)
+        UpdateDrawListSharedData(data);
+    return data;
+}
+
+void ImGui::DestroyDrawListSharedData(ImDrawListSharedData* data)
+{
+    IM_DELETE(data);
+}
+
+// Copy settings only. Scratch buffers (TempBuffer) and the list of owned ImDrawList are left untouched, making the copy safe to use from another thread.
+void ImGui::UpdateDrawListSharedData(ImDrawListSharedData* data)
+{
+    ImGuiContext& g = *GImGui;
+    const ImDrawListSharedData* src = &g.DrawListSharedData;
+    IM_ASSERT(data != src);
+    data->TexUvWhitePixel = src->TexUvWhitePixel;
+    // Copy UV tables by value: ImFontAtlasTextureRepack() rewrites the atlas arrays in place, and they need to stay paired with FontTexRef.
+    if (src->TexUvLines)
+        memcpy(data->TexUvLinesCopy, src->TexUvLines, sizeof(data->TexUvLinesCopy));
+    if (src->TexUvCorners)
+        memcpy(data->TexUvCornersCopy, src->TexUvCorners, sizeof(data->TexUvCornersCopy));
+    data->TexUvLines = src->TexUvLines ? data->TexUvLinesCopy : NULL;
+    data->TexUvCorners = src->TexUvCorners ? data->TexUvCornersCopy : NULL;
+    data->FontAtlas = src->FontAtlas;
+    data->Font = src->Font;
+    data->FontSize = src->FontSize;
+    data->FontScale = src->FontScale;
+    data->CurveTessellationTol = src->CurveTessellationTol;
+    data->SetCircleTessellationMaxError(src->CircleSegmentMaxError);
+    data->InitialFringeScale = src->InitialFringeScale;
+    data->InitialFlags = src->InitialFlags;
+    data->ClipRectFullscreen = src->ClipRectFullscreen;
+    data->FontTexRef = src->FontAtlas ? src->FontAtlas->TexRef : ImTextureRef();
+}
+
+// Only accesses 'draw_list' and its ImDrawListSharedData, so this is safe to call from a worker thread.
+// The font atlas texture and its UV tables were copied by UpdateDrawListSharedData(): the atlas may be modified by the main thread while jobs are running.
+void ImGui::ResetWorkerDrawList(ImDrawList* draw_list)
+{
+    ImDrawListSharedData* data = draw_list->_Data;
+    IM_ASSERT(data != NULL && data->Context == NULL && "Use a ImDrawListSharedData created with CreateDrawListSharedData().");
+    draw_list->_ResetForNewFrame();
+    draw_list->PushClipRectFullScreen();
+
+    // Not using PushTexture(): its assert reads ImTextureData::WantDestroyNextFrame, which the main thread may write while repacking the atlas.
+    draw_list->_TextureStack.push_back(data->FontTexRef);
+    draw_list->_CmdHeader.TexRef = data->FontTexRef;
+    draw_list->_OnChangedTexture();
+}
+
+void ImGui::AddWindowDrawList(ImDrawList* draw_list)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(window != NULL && "Call AddWindowDrawList() between Begin() and End()!");
+    IM_ASSERT(draw_list != NULL && draw_list != window->DrawList);
+    window->DrawListsExtra.push_back(draw_list);
+}
+
+// Used to process draw data, 'func' must be self-contained (no ImGui:: call, no memory allocation).
+// Dispatching to worker threads has a cost (generally a few microseconds), only worth it for large enough 'work_size'.
+void ImGui::ParallelFor(int count, int work_size, void (*func)(void* func_data, int index), void* func_data)
+{
+    ImGuiContext* ctx = GImGui;
+    const int PARALLEL_FOR_MIN_WORK_SIZE = 16 * 1024;
+    if (ctx != NULL && ctx->PlatformIO.Platform_ParallelForFn != NULL && count > 1 && work_size >= PARALLEL_FOR_MIN_WORK_SIZE)
+    {
+        ctx->PlatformIO.Platform_ParallelForFn(ctx, count, func, func_data);
+        return;
+    }
+    for (int n = 0; n < count; n++)
+        func(func_data, n);
+}
+
 void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 {
     // Set ActiveId even if the _NoMove flag is set. Without it, dragging away from a window with _NoMove would activate hover on other windows.
@@ -5386,9 +5603,19 @@ static void SetupDrawListSharedData()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
+    if (g.Style.AntiAliasedFill && g.Style.AntiAliasedFillUseTex && !(g.IO.Fonts->Flags & ImFontAtlasFlags_NoBakedCorners))
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFillUseTex;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
     g.DrawListSharedData.InitialFringeScale = 1.0f; // FIXME-DPI: Change this for some DPI scaling experiments.
+
+    // Text layout cache
+    g.DrawListSharedData.TextLayoutCache = g.IO.ConfigTextLayoutCache ? &g.TextLayoutCache : NULL;
+    g.TextLayoutCache.FrameCount = g.FrameCount;
+    if (!g.IO.ConfigTextLayoutCache)
+        g.TextLayoutCache.Clear();
+    else if ((g.FrameCount % 16) == 0) // Scanning all layouts is not free, it doesn't need to happen every frame
+        g.TextLayoutCache.DiscardUnused(IM_TEXT_LAYOUT_CACHE_UNUSED_FRAMES);
 }
 
 void ImGui::NewFrame()
@@ -5404,6 +5631,13 @@ void ImGui::NewFrame()
 
     CallContextHooks(&g, ImGuiContextHookType_NewFramePre);
 
+    // [DEBUG] Record allocations from this thread. Start recording profiler scopes for this frame
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    g.DebugAllocInfo.OwnerThreadTag = &GImDebugAllocThreadTag;
+    DebugProfilerFrameBegin();
+#endif
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("NewFrame", ImGuiDebugProfilerScopeType_Phase, 0);
+
     // Check and assert for various common IO and Configuration mistakes
     ErrorCheckNewFrameSanityChecks();
 
@@ -5412,6 +5646,7 @@ void ImGui::NewFrame()
 
     g.Time += g.IO.DeltaTime;
     g.FrameCount += 1;
+    g.NextFrameDeadline = FLT_MAX;
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -5425,17 +5660,23 @@ void ImGui::NewFrame()
 
     // Process input queue (trickle as many events as possible), turn events into writes to IO structure
     g.InputEventsTrail.resize(0);
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("UpdateInputEvents", ImGuiDebugProfilerScopeType_Phase, 0);
     UpdateInputEvents(g.IO.ConfigInputTrickleEventQueue);
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
 
     // Update viewports (after processing input queue, so io.MouseHoveredViewport is set)
     UpdateViewportsNewFrame();
 
     // Update texture list (collect destroyed textures, etc.)
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("UpdateTexturesNewFrame", ImGuiDebugProfilerScopeType_Phase, 0);
     UpdateTexturesNewFrame();
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
 
     // Setup current font and draw list shared data
     SetupDrawListSharedData();
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("UpdateFontsNewFrame", ImGuiDebugProfilerScopeType_Phase, 0);
     UpdateFontsNewFrame();
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
 
     g.WithinFrameScope = true;
 
@@ -5562,12 +5803,15 @@ void ImGui::NewFrame()
     g.TooltipPreviousWindow = NULL;
 
     // Update keyboard/gamepad navigation
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("NavUpdate", ImGuiDebugProfilerScopeType_Phase, 0);
     NavUpdate();
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
 
     // Update mouse input state
     UpdateMouseInputs();
 
     // Mark all windows as not visible and compact unused memory.
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("GcCompactWindows", ImGuiDebugProfilerScopeType_Phase, 0);
     IM_ASSERT(g.WindowsFocusOrder.Size <= g.Windows.Size);
     const float memory_compact_start_time = (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer < 0.0f) ? FLT_MAX : (float)g.Time - g.IO.ConfigMemoryCompactTimer;
     for (ImGuiWindow* window : g.Windows)
@@ -5582,11 +5826,14 @@ void ImGui::NewFrame()
         if (!window->WasActive && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
             GcCompactTransientWindowBuffers(window);
     }
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
 
     // Find hovered window
     // (needs to be before UpdateMouseMovingWindowNewFrame so we fill g.HoveredWindowUnderMovingWindow on the mouse release frame)
     // (currently needs to be done after the WasActive=Active loop and FindHoveredWindowEx uses ->Active)
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("UpdateHoveredWindowAndCaptureFlags", ImGuiDebugProfilerScopeType_Phase, 0);
     UpdateHoveredWindowAndCaptureFlags(g.IO.MousePos);
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
 
     // Handle user moving window with mouse (at the beginning of the frame to avoid input lag or sheering)
     UpdateMouseMovingWindowNewFrame();
@@ -5608,6 +5855,7 @@ void ImGui::NewFrame()
     UpdateMouseWheel();
 
     // Garbage collect transient buffers of recently unused tables
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("GcCompactTables", ImGuiDebugProfilerScopeType_Phase, 0);
     for (int i = 0; i < g.TablesLastTimeActive.Size; i++)
         if (g.TablesLastTimeActive[i] >= 0.0f && g.TablesLastTimeActive[i] < memory_compact_start_time)
             TableGcCompactTransientBuffers(g.Tables.GetByIndex(i));
@@ -5617,6 +5865,7 @@ void ImGui::NewFrame()
     if (g.GcCompactAll)
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
 
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
@@ -5670,6 +5919,7 @@ void ImGui::NewFrame()
         g.DebugBeginReturnValueCullDepth = -1;
 #endif
 
+    IMGUI_DEBUG_PROFILER_SCOPE_END(); // "NewFrame"
     CallContextHooks(&g, ImGuiContextHookType_NewFramePost);
 }
 
@@ -5706,9 +5956,11 @@ static void AddWindowToDrawData(ImGuiWindow* window, int layer)
     ImGuiContext& g = *GImGui;
     ImGuiViewportP* viewport = g.Viewports[0];
     g.IO.MetricsRenderWindows++;
-    if (window->DrawList->_Splitter._Count > 1)
+    while (window->DrawList->_Splitter._Count > 1 || window->DrawList->_Splitter._Parents.Size > 0)
         window->DrawList->ChannelsMerge(); // Merge if user forgot to merge back. Also required in Docking branch for ImGuiWindowFlags_DockNodeHost windows.
     ImGui::AddDrawListToDrawDataEx(&viewport->DrawDataP, viewport->DrawDataBuilder.Layers[layer], window->DrawList);
+    for (ImDrawList* draw_list : window->DrawListsExtra)
+        ImGui::AddDrawListToDrawDataEx(&viewport->DrawDataP, viewport->DrawDataBuilder.Layers[layer], draw_list);
     for (ImGuiWindow* child : window->DC.ChildWindows)
         if (IsWindowActiveAndVisible(child)) // Clipped children may have been marked not active
             AddWindowToDrawData(child, layer);
@@ -5743,6 +5995,158 @@ static void FlattenDrawDataIntoSingleLayer(ImDrawDataBuilder* builder)
     }
 }
 
+// Used by io.ConfigRenderMergeDrawLists.
+// - Callbacks may rely on their parent list (e.g. to access its buffers), lists using them are never merged.
+// - With 16-bit indices we can't rebase indices past 64K vertices, lists using ImDrawCmd::VtxOffset are never merged.
+static bool IsDrawListMergeable(const ImDrawList* draw_list)
+{
+    if (draw_list->_ArenaVtxOffset != 0 || draw_list->_ArenaIdxOffset != 0 || (draw_list->Flags & ImDrawListFlags_IdxPacked16)) // Persistent list already processed by a previous Render()
+        return false;
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        if (cmd.UserCallback != NULL || cmd.VtxOffset != 0)
+            return false;
+    return true;
+}
+
+// Return true if all vertices used by a command are inside its clipping rectangle, in which case its clipping rectangle may be enlarged without changing the output.
+static bool IsDrawCmdWithinClipRect(const ImDrawList* draw_list, const ImDrawCmd* cmd)
+{
+    const ImVec4 clip_rect = cmd->ClipRect;
+    const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + cmd->VtxOffset;
+    for (unsigned int idx_n = cmd->IdxOffset; idx_n < cmd->IdxOffset + cmd->ElemCount; idx_n++)
+    {
+        const ImVec2 pos = vtx_buffer[draw_list->IdxBuffer.Data[idx_n]].pos;
+        if (pos.x < clip_rect.x || pos.y < clip_rect.y || pos.x > clip_rect.z || pos.y > clip_rect.w)
+            return false;
+    }
+    return true;
+}
+
+// Concatenate consecutive compatible draw lists into lists owned by the viewport, and merge draw commands:
+// - when they have the same texture and clipping rectangle, or
+// - when they have the same texture and all their vertices are inside their own clipping rectangle (merged command uses the union of clipping rectangles).
+// Order of lists and commands is preserved, so is z-order. Needs to run before PackIndexBuffers() and ExportToArena().
+static void MergeViewportDrawLists(ImGuiViewportP* viewport)
+{
+    ImGuiContext& g = *GImGui;
+    ImDrawData* draw_data = &viewport->DrawDataP;
+    ImDrawDataBuilder* builder = &viewport->DrawDataBuilder;
+    ImVector<ImDrawList*>& draw_lists = draw_data->CmdLists;
+    const bool limit_16bit = (sizeof(ImDrawIdx) == 2) || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasIdxSize); // Keep merged lists small enough for PackIndexBuffers()
+    const int max_vtx_count = limit_16bit ? (1 << 16) : INT_MAX;
+
+    builder->MergeStatsListsIn = draw_lists.Size;
+    builder->MergeStatsCmdsIn = 0;
+    for (ImDrawList* draw_list : draw_lists)
+        builder->MergeStatsCmdsIn += draw_list->CmdBuffer.Size;
+
+    int merged_lists_used = 0;
+    int write_n = 0;
+    for (int read_n = 0; read_n < draw_lists.Size; )
+    {
+        // Find a group of consecutive mergeable lists
+        int group_end = read_n + 1;
+        if (IsDrawListMergeable(draw_lists[read_n]))
+            for (int vtx_count = draw_lists[read_n]->VtxBuffer.Size; group_end < draw_lists.Size && IsDrawListMergeable(draw_lists[group_end]) && vtx_count + draw_lists[group_end]->VtxBuffer.Size <= max_vtx_count; group_end++)
+                vtx_count += draw_lists[group_end]->VtxBuffer.Size;
+        if (group_end - read_n == 1)
+        {
+            draw_lists[write_n++] = draw_lists[read_n++];
+            continue;
+        }
+
+        if (merged_lists_used == builder->MergedLists.Size)
+        {
+            ImDrawList* new_list = IM_NEW(ImDrawList)(&g.DrawListSharedData);
+            new_list->_OwnerName = "##Merged";
+            builder->MergedLists.push_back(new_list);
+        }
+        ImDrawList* out_list = builder->MergedLists[merged_lists_used++];
+        out_list->CmdBuffer.resize(0);
+        out_list->IdxBuffer.resize(0);
+        out_list->VtxBuffer.resize(0);
+        out_list->Flags = draw_lists[read_n]->Flags;
+        out_list->_ArenaVtxOffset = out_list->_ArenaIdxOffset = 0;
+
+        bool last_cmd_within_clip_rect = false;
+        for (; read_n < group_end; read_n++)
+        {
+            const ImDrawList* src_list = draw_lists[read_n];
+            const int vtx_base = out_list->VtxBuffer.Size;
+            out_list->VtxBuffer.resize(vtx_base + src_list->VtxBuffer.Size);
+            if (src_list->VtxBuffer.Size > 0)
+                memcpy(out_list->VtxBuffer.Data + vtx_base, src_list->VtxBuffer.Data, (size_t)src_list->VtxBuffer.Size * sizeof(ImDrawVert));
+            for (const ImDrawCmd& src_cmd : src_list->CmdBuffer)
+            {
+                if (src_cmd.ElemCount == 0)
+                    continue;
+                const int idx_base = out_list->IdxBuffer.Size;
+                out_list->IdxBuffer.resize(idx_base + (int)src_cmd.ElemCount);
+                const ImDrawIdx* src_idx = src_list->IdxBuffer.Data + src_cmd.IdxOffset;
+                ImDrawIdx* dst_idx = out_list->IdxBuffer.Data + idx_base;
+                for (unsigned int n = 0; n < src_cmd.ElemCount; n++)
+                    dst_idx[n] = (ImDrawIdx)(src_idx[n] + vtx_base);
+
+                // Each source command is scanned once: a merged command is within its clipping rectangle if all its parts were.
+                ImDrawCmd cmd = src_cmd;
+                cmd.IdxOffset = (unsigned int)idx_base;
+                const bool cmd_within_clip_rect = IsDrawCmdWithinClipRect(out_list, &cmd);
+                ImDrawCmd* prev_cmd = out_list->CmdBuffer.Size > 0 ? &out_list->CmdBuffer.back() : NULL;
+                if (prev_cmd != NULL && prev_cmd->TexRef == cmd.TexRef)
+                {
+                    if (memcmp(&prev_cmd->ClipRect, &cmd.ClipRect, sizeof(ImVec4)) == 0)
+                    {
+                        prev_cmd->ElemCount += cmd.ElemCount;
+                        last_cmd_within_clip_rect &= cmd_within_clip_rect;
+                        continue;
+                    }
+                    if (last_cmd_within_clip_rect && cmd_within_clip_rect)
+                    {
+                        prev_cmd->ClipRect = ImVec4(ImMin(prev_cmd->ClipRect.x, cmd.ClipRect.x), ImMin(prev_cmd->ClipRect.y, cmd.ClipRect.y), ImMax(prev_cmd->ClipRect.z, cmd.ClipRect.z), ImMax(prev_cmd->ClipRect.w, cmd.ClipRect.w));
+                        prev_cmd->ElemCount += cmd.ElemCount;
+                        continue;
+                    }
+                }
+                out_list->CmdBuffer.push_back(cmd);
+                last_cmd_within_clip_rect = cmd_within_clip_rect;
+            }
+        }
+        if (out_list->CmdBuffer.Size == 0)
+            out_list->AddDrawCmd(); // Keep at least one command, like other lists
+        draw_lists[write_n++] = out_list;
+    }
+    draw_lists.resize(write_n);
+    draw_data->CmdListsCount = write_n;
+
+    builder->MergeStatsListsOut = draw_lists.Size;
+    builder->MergeStatsCmdsOut = 0;
+    for (ImDrawList* draw_list : draw_lists)
+        builder->MergeStatsCmdsOut += draw_list->CmdBuffer.Size;
+}
+
+// Used by io.ConfigRenderDetectUnchangedFrames. Needs to run before PackIndexBuffers()/ExportToArena() alter draw lists.
+// - Callbacks may draw anything: draw data using them is never reported unchanged.
+// - Pending texture requests (e.g. new glyphs) would change output even with identical draw lists.
+static void UpdateViewportDrawDataUnchanged(ImGuiViewportP* viewport)
+{
+    ImGuiContext& g = *GImGui;
+    ImDrawData* draw_data = &viewport->DrawDataP;
+    draw_data->ContentHash = draw_data->CalcContentHash();
+
+    bool unchanged = (viewport->DrawDataLastContentHashFrame == g.FrameCount - 1) && (viewport->DrawDataLastContentHash == draw_data->ContentHash);
+    for (int list_n = 0; list_n < draw_data->CmdLists.Size && unchanged; list_n++)
+        for (const ImDrawCmd& cmd : draw_data->CmdLists[list_n]->CmdBuffer)
+            if (cmd.UserCallback != NULL && cmd.UserCallback != ImDrawCallback_ResetRenderState)
+                unchanged = false;
+    if (draw_data->Textures != NULL)
+        for (int tex_n = 0; tex_n < draw_data->Textures->Size && unchanged; tex_n++)
+            if ((*draw_data->Textures)[tex_n]->Status != ImTextureStatus_OK && (*draw_data->Textures)[tex_n]->Status != ImTextureStatus_Destroyed)
+                unchanged = false;
+    draw_data->Unchanged = unchanged;
+    viewport->DrawDataLastContentHash = draw_data->ContentHash;
+    viewport->DrawDataLastContentHashFrame = g.FrameCount;
+}
+
 static void InitViewportDrawData(ImGuiViewportP* viewport)
 {
     ImGuiIO& io = ImGui::GetIO();
@@ -5756,10 +6160,15 @@ static void InitViewportDrawData(ImGuiViewportP* viewport)
     draw_data->Valid = true;
     draw_data->CmdListsCount = 0;
     draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    draw_data->IdxSize = sizeof(ImDrawIdx);
     draw_data->DisplayPos = viewport->Pos;
     draw_data->DisplaySize = viewport->Size;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
     draw_data->OwnerViewport = viewport;
+    draw_data->ArenaVtxBuffer = NULL;
+    draw_data->ArenaIdxBuffer = NULL;
+    draw_data->ContentHash = 0;
+    draw_data->Unchanged = false;
     draw_data->Textures = &ImGui::GetPlatformIO().Textures;
 }
 
@@ -5867,6 +6276,59 @@ static void ImGui::RenderDimmedBackgrounds()
     }
 }
 
+// Called by EndFrame(). Combine RequestNextFrame() calls made during the frame with global state needing more frames.
+// Err on the side of requesting frames: a missing one leaves stale contents on screen until next input.
+static void ImGui::UpdateNextFrameDeadline()
+{
+    ImGuiContext& g = *GImGui;
+
+    // Inputs processed this frame may have changed application state or opened windows (submitted on next frame), inputs queued by trickling are still pending.
+    // Applications typically render an extra frame after input events, this is the same.
+    bool need_frame_now = g.InputEventsTrail.Size > 0 || g.InputEventsQueue.Size > 0;
+
+    // Overrides applied to io.WantCaptureXXX on next frame, requests processed on next frame
+    need_frame_now |= (g.WantCaptureMouseNextFrame != -1 && (g.WantCaptureMouseNextFrame != 0) != g.IO.WantCaptureMouse);
+    need_frame_now |= (g.WantCaptureKeyboardNextFrame != -1 && (g.WantCaptureKeyboardNextFrame != 0) != g.IO.WantCaptureKeyboard);
+    need_frame_now |= (g.WantTextInputNextFrame != -1 && (g.WantTextInputNextFrame != 0) != g.IO.WantTextInput);
+    need_frame_now |= g.NavInitRequest || g.NavMoveSubmitted || g.NavMoveForwardToNextFrame || g.NavNextActivateId != 0;
+    need_frame_now |= g.NavWindowingTarget != NULL || g.NavWindowingHighlightAlpha > 0.0f;
+    need_frame_now |= (GetTopMostPopupModal() != NULL) ? (g.DimBgRatio < 1.0f) : (g.DimBgRatio > 0.0f);
+    for (const ImGuiPopupData& popup_data : g.OpenPopupStack)
+        need_frame_now |= (popup_data.Window == NULL); // Opened after its BeginPopup() call
+
+    // Windows being auto-fit, measured while hidden or scrolled
+    for (ImGuiWindow* window : g.Windows)
+        if (window->Active || window->WasActive)
+            need_frame_now |= window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesForRenderOnly > 0
+                || window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX;
+
+    // Pending texture creation/updates/destruction (e.g. font atlas growing). Backend will process them after Render(), next frame finalizes them.
+    for (ImTextureData* tex : g.PlatformIO.Textures)
+        need_frame_now |= (tex->Status != ImTextureStatus_OK || tex->WantDestroyNextFrame);
+    if (need_frame_now)
+        RequestNextFrame();
+
+    // Timers
+    if (g.NavHighlightActivatedTimer > 0.0f)
+        RequestNextFrame(g.NavHighlightActivatedTimer);
+    if (g.WheelingWindowReleaseTimer > 0.0f)
+        RequestNextFrame(g.WheelingWindowReleaseTimer);
+    if (g.SettingsDirtyTimer > 0.0f)
+        RequestNextFrame(g.SettingsDirtyTimer);
+
+    // Held keys and mouse buttons may repeat: refresh continuously once they may start repeating (nav repeat starts a bit earlier than io.KeyRepeatDelay).
+    for (ImGuiKey key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END; key = (ImGuiKey)(key + 1))
+    {
+        if (IsLRModKey(key) || (key >= ImGuiKey_ReservedForModCtrl && key <= ImGuiKey_ReservedForModSuper))
+            continue;
+        const ImGuiKeyData* key_data = GetKeyData(key);
+        if (key_data->Down)
+            RequestNextFrame(g.IO.KeyRepeatDelay * 0.72f - key_data->DownDuration);
+    }
+
+    g.IO.NextFrameDeadline = g.NextFrameDeadline;
+}
+
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
@@ -5883,6 +6345,7 @@ void ImGui::EndFrame()
     }
 
     CallContextHooks(&g, ImGuiContextHookType_EndFramePre);
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("EndFrame", ImGuiDebugProfilerScopeType_Phase, 0);
 
     // [EXPERIMENTAL] Recover from errors
     if (g.IO.ConfigErrorRecovery)
@@ -5908,7 +6371,9 @@ void ImGui::EndFrame()
     End();
 
     // Update navigation: Ctrl+Tab, wrap-around requests
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("NavEndFrame", ImGuiDebugProfilerScopeType_Phase, 0);
     NavEndFrame();
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
 
     // Drag and Drop: Elapse payload (if delivered, or if source stops being submitted)
     if (g.DragDropActive)
@@ -5941,6 +6406,7 @@ void ImGui::EndFrame()
 
     // Sort the window list so that all child windows are after their parent
     // We cannot do that on FocusWindow() because children may not exist yet
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("SortWindows", ImGuiDebugProfilerScopeType_Phase, 0);
     g.WindowsTempSortBuffer.resize(0);
     g.WindowsTempSortBuffer.reserve(g.Windows.Size);
     for (ImGuiWindow* window : g.Windows)
@@ -5954,8 +6420,14 @@ void ImGui::EndFrame()
     IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
     g.Windows.swap(g.WindowsTempSortBuffer);
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
 
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("UpdateTexturesEndFrame", ImGuiDebugProfilerScopeType_Phase, 0);
     UpdateTexturesEndFrame();
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
+
+    // Tell application when next frame is needed
+    UpdateNextFrameDeadline();
 
     // Unlock font atlas
     for (ImFontAtlas* atlas : g.FontAtlases)
@@ -5967,6 +6439,7 @@ void ImGui::EndFrame()
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
     g.IO.InputQueueCharacters.resize(0);
 
+    IMGUI_DEBUG_PROFILER_SCOPE_END(); // "EndFrame"
     CallContextHooks(&g, ImGuiContextHookType_EndFramePost);
 }
 
@@ -5986,6 +6459,7 @@ void ImGui::Render()
 
     g.IO.MetricsRenderWindows = 0;
     CallContextHooks(&g, ImGuiContextHookType_RenderPre);
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("Render", ImGuiDebugProfilerScopeType_Phase, 0);
 
     // Add background ImDrawList (for each active viewport)
     for (ImGuiViewportP* viewport : g.Viewports)
@@ -5999,6 +6473,7 @@ void ImGui::Render()
     RenderDimmedBackgrounds();
 
     // Add ImDrawList to render
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("AddDrawListToDrawDataEx", ImGuiDebugProfilerScopeType_Phase, 0);
     ImGuiWindow* windows_to_render_top_most[2];
     windows_to_render_top_most[0] = (g.NavWindowingTarget && !(g.NavWindowingTarget->Flags & ImGuiWindowFlags_NoBringToFrontOnFocus)) ? g.NavWindowingTarget->RootWindow : NULL;
     windows_to_render_top_most[1] = (g.NavWindowingTarget ? g.NavWindowingListWindow : NULL);
@@ -6011,6 +6486,7 @@ void ImGui::Render()
     for (int n = 0; n < IM_ARRAYSIZE(windows_to_render_top_most); n++)
         if (windows_to_render_top_most[n] && IsWindowActiveAndVisible(windows_to_render_top_most[n])) // NavWindowingTarget is always temporarily displayed as the top-most window
             AddRootWindowToDrawData(windows_to_render_top_most[n]);
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
 
     // Draw software mouse cursor if requested by io.MouseDrawCursor flag
     if (g.IO.MouseDrawCursor && g.MouseCursor != ImGuiMouseCursor_None)
@@ -6018,6 +6494,7 @@ void ImGui::Render()
 
     // Setup ImDrawData structures for end-user
     g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = 0;
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN("FlattenDrawDataIntoSingleLayer", ImGuiDebugProfilerScopeType_Phase, 0);
     for (ImGuiViewportP* viewport : g.Viewports)
     {
         FlattenDrawDataIntoSingleLayer(&viewport->DrawDataBuilder);
@@ -6032,9 +6509,32 @@ void ImGui::Render()
         for (ImDrawList* draw_list : draw_data->CmdLists)
             draw_list->_PopUnusedDrawCmd();
 
+        // Detect output identical to previous frame, so application/backends may skip rendering it
+        if (g.IO.ConfigRenderDetectUnchangedFrames)
+            UpdateViewportDrawDataUnchanged(viewport);
+
+        // Reduce draw calls by merging consecutive draw lists
+        if (g.IO.ConfigRenderMergeDrawLists)
+            MergeViewportDrawLists(viewport);
+
+        // Pack to 16-bit indices when possible, if backend supports a runtime index size
+        if (sizeof(ImDrawIdx) == 4 && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasIdxSize))
+            draw_data->PackIndexBuffers();
+
+        // Write all vertices/indices into buffers provided by the renderer backend
+        if (g.PlatformIO.Renderer_GetDrawDataArenaFn != NULL && draw_data->TotalVtxCount > 0)
+        {
+            IM_ASSERT((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset) && "Renderer_GetDrawDataArenaFn requires support for ImDrawCmd::VtxOffset!");
+            ImDrawVert* vtx_dst = NULL;
+            void* idx_dst = NULL;
+            if (g.PlatformIO.Renderer_GetDrawDataArenaFn(&g, draw_data, &vtx_dst, &idx_dst))
+                draw_data->ExportToArena(vtx_dst, idx_dst);
+        }
+
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
     }
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
 
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures)
@@ -6042,6 +6542,10 @@ void ImGui::Render()
             ImFontAtlasDebugLogTextureRequests(atlas);
 #endif
 
+    IMGUI_DEBUG_PROFILER_SCOPE_END(); // "Render"
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    DebugProfilerFrameEnd();
+#endif
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
 
@@ -6061,7 +6565,29 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+
+    // Measure or use cached size (io.ConfigTextLayoutCache)
+    ImVec2 text_size;
+    ImTextLayout* layout = NULL;
+    if (g.DrawListSharedData.TextLayoutCache != NULL)
+    {
+        if (text_display_end == NULL)
+            text_display_end = text + ImStrlen(text);
+        layout = g.TextLayoutCache.GetLayout(font, g.FontBaked, font_size, wrap_width, text, text_display_end);
+    }
+    if (layout && layout->SizeValid)
+    {
+        text_size = layout->TextSize;
+    }
+    else
+    {
+        text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+        if (layout)
+        {
+            layout->TextSize = text_size;
+            layout->SizeValid = true;
+        }
+    }
 
     // Round
     // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
@@ -7311,6 +7837,10 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     const bool first_begin_of_the_frame = (window->LastFrameActive != current_frame);
     window->IsFallbackWindow = (g.CurrentWindowStack.Size == 0 && g.WithinFrameScopeWithImplicitWindow);
 
+    // [DEBUG] Profiler (the implicit "Debug" window is never ended explicitly, so don't record it)
+    if (!window->IsFallbackWindow)
+        IMGUI_DEBUG_PROFILER_SCOPE_BEGIN(window->Name, ImGuiDebugProfilerScopeType_Window, window->ID);
+
     // Update the Appearing flag
     bool window_just_activated_by_user = (window->LastFrameActive < current_frame - 1);   // Not using !WasActive because the implicit "Debug" window would always toggle off->on
     if (flags & ImGuiWindowFlags_Popup)
@@ -7464,6 +7994,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->ClipRect = ImVec4(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
         window->IDStack.resize(1);
         window->DrawList->_ResetForNewFrame();
+        window->DrawListsExtra.resize(0);
         window->DC.CurrentTableIdx = -1;
 
         // Restore buffer capacity when woken from a compacted state, to avoid
@@ -8134,6 +8665,9 @@ void ImGui::End()
 
     g.CurrentWindowStack.pop_back();
     SetCurrentWindow(g.CurrentWindowStack.Size == 0 ? NULL : g.CurrentWindowStack.back().Window);
+
+    if (!window->IsFallbackWindow)
+        IMGUI_DEBUG_PROFILER_SCOPE_END();
 }
 
 void ImGui::PushItemFlag(ImGuiItemFlags option, bool enabled)
@@ -8829,6 +9363,10 @@ static void ImGui::UpdateTexturesEndFrame()
     ImGuiContext& g = *GImGui;
     g.PlatformIO.Textures.resize(0);
     for (ImFontAtlas* atlas : g.FontAtlases)
+    {
+        // Start rasterizing glyphs loaded during the frame (ImFontAtlasFlags_AsyncGlyphLoad)
+        if (atlas->OwnerContext == &g)
+            ImFontAtlasBuildStartAsyncGlyphs(atlas);
         for (ImTextureData* tex : atlas->TexList)
         {
             // We provide this information so backends can decide whether to destroy textures.
@@ -8836,6 +9374,7 @@ static void ImGui::UpdateTexturesEndFrame()
             tex->RefCount = (unsigned short)atlas->RefCount;
             g.PlatformIO.Textures.push_back(tex);
         }
+    }
     for (ImTextureData* tex : g.UserTextures)
         g.PlatformIO.Textures.push_back(tex);
 }
@@ -15602,11 +16141,19 @@ void ImGuiPlatformIO::ClearPlatformHandlers()
     Platform_OpenInShellUserData = NULL;
     Platform_SetImeDataFn = NULL;
     Platform_ImeUserData = NULL;
+    Platform_GetTimeNsFn = NULL;
+    Platform_ParallelForFn = NULL;
+    Platform_ParallelForUserData = NULL;
+    Platform_AsyncJobStartFn = NULL;
+    Platform_AsyncJobWaitFn = NULL;
+    Platform_AsyncJobUserData = NULL;
 }
 
 void ImGuiPlatformIO::ClearRendererHandlers()
 {
     Renderer_TextureMaxWidth = Renderer_TextureMaxHeight = 0;
+    Renderer_GetDrawDataArenaFn = NULL;
+    Renderer_DrawDataArenaUserData = NULL;
     Renderer_RenderState = NULL;
 }
 
@@ -15678,6 +16225,7 @@ static void ImGui::UpdateViewportsNewFrame()
 // - Default clipboard handlers
 // - Default shell function handlers
 // - Default IME handlers
+// - Default high-resolution clock
 //-----------------------------------------------------------------------------
 
 #if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS)
@@ -15904,6 +16452,38 @@ static void Platform_SetImeDataFn_DefaultImpl(ImGuiContext*, ImGuiViewport*, ImG
 
 #endif // Default IME handlers
 
+//-----------------------------------------------------------------------------
+
+// Monotonic clock used by the profiler in Metrics/Debugger
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+
+static ImU64 Platform_GetTimeNsFn_DefaultImpl(ImGuiContext*)
+{
+    static LARGE_INTEGER frequency = {};
+    if (frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (ImU64)((double)counter.QuadPart * 1000000000.0 / (double)frequency.QuadPart);
+}
+
+#elif defined(__unix__) || defined(__APPLE__) || defined(__EMSCRIPTEN__)
+
+#include <time.h>   // clock_gettime()
+static ImU64 Platform_GetTimeNsFn_DefaultImpl(ImGuiContext*)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+}
+
+#else
+
+// Fallback to io.DeltaTime accumulation: only suitable to measure whole frames!
+static ImU64 Platform_GetTimeNsFn_DefaultImpl(ImGuiContext* ctx) { return (ImU64)(ctx->Time * 1000000000.0); }
+
+#endif // Default high-resolution clock
+
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUGGER WINDOW
 //-----------------------------------------------------------------------------
@@ -16254,6 +16834,15 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     const int discarded_surface_sqrt = (int)sqrtf((float)atlas->Builder->RectsDiscardedSurface);
     Text("Packed rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsPackedCount, atlas->Builder->RectsPackedSurface, packed_surface_sqrt, packed_surface_sqrt);
     Text("incl. Discarded rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsDiscardedCount, atlas->Builder->RectsDiscardedSurface, discarded_surface_sqrt, discarded_surface_sqrt);
+    if (atlas->Flags & ImFontAtlasFlags_AsyncGlyphLoad)
+        Text("Async glyphs: %d queued, %d jobs running, %d committed", atlas->Builder->AsyncGlyphsQueued.Size, atlas->Builder->AsyncJobs.Size, atlas->Builder->AsyncGlyphsCommitted);
+    if (atlas->Flags & ImFontAtlasFlags_MultiPage)
+    {
+        int pages_active = 0;
+        for (ImFontAtlasPage* page : atlas->Builder->Pages)
+            pages_active += (page->Tex != NULL);
+        Text("Pages: %d active, %d released, %dx%d", pages_active, atlas->Builder->Pages.Size - pages_active, atlas->TexPageSize, atlas->TexPageSize);
+    }
 
     ImFontAtlasRectId highlight_r_id = ImFontAtlasRectId_Invalid;
     if (TreeNode("Rects Index", "Rects Index (%d)", atlas->Builder->RectsPackedCount)) // <-- Use count of used rectangles
@@ -16268,13 +16857,13 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
                     ImFontAtlasRect r = {};
                     atlas->GetCustomRect(id, &r);
                     const char* buf;
-                    ImFormatStringToTempBuffer(&buf, NULL, "ID:%08X, used:%d, { w:%3d, h:%3d } { x:%4d, y:%4d }", id, entry.IsUsed, r.w, r.h, r.x, r.y);
+                    ImFormatStringToTempBuffer(&buf, NULL, "ID:%08X, used:%d, { w:%3d, h:%3d } { x:%4d, y:%4d }, page:%d", id, entry.IsUsed, r.w, r.h, r.x, r.y, entry.PageIndex);
                     TableNextColumn();
                     Selectable(buf);
                     if (IsItemHovered())
                         highlight_r_id = id;
                     TableNextColumn();
-                    Image(atlas->TexRef, ImVec2(r.w, r.h), r.uv0, r.uv1);
+                    Image(ImFontAtlasPageGetTexture(atlas, entry.PageIndex)->GetTexRef(), ImVec2(r.w, r.h), r.uv0, r.uv1);
                 }
             EndTable();
         }
@@ -16291,7 +16880,7 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     {
         if (tex_n == atlas->TexList.Size - 1)
             SetNextItemOpen(true, ImGuiCond_Once);
-        DebugNodeTexture(atlas->TexList[tex_n], atlas->TexList.Size - 1 - tex_n, (highlight_r_id != ImFontAtlasRectId_Invalid) ? &highlight_r : NULL);
+        DebugNodeTexture(atlas->TexList[tex_n], atlas->TexList.Size - 1 - tex_n, (highlight_r_id != ImFontAtlasRectId_Invalid && atlas->TexList[tex_n] == ImFontAtlasPackGetTexture(atlas, highlight_r_id)) ? &highlight_r : NULL);
     }
 }
 
@@ -16357,6 +16946,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     Text("%d visible windows, %d current allocations", io.MetricsRenderWindows, g.DebugAllocInfo.TotalAllocCount - g.DebugAllocInfo.TotalFreeCount);
+    if (io.NextFrameDeadline >= FLT_MAX)
+        Text("Next frame needed: on input");
+    else
+        Text("Next frame needed: in %.3f s", ImMax(0.0, io.NextFrameDeadline - g.Time));
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
     Separator();
@@ -16549,6 +17142,20 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     {
         Checkbox("Show ImDrawCmd mesh when hovering", &cfg->ShowDrawCmdMesh);
         Checkbox("Show ImDrawCmd bounding boxes when hovering", &cfg->ShowDrawCmdBoundingBoxes);
+        Checkbox("io.ConfigRenderMergeDrawLists", &io.ConfigRenderMergeDrawLists);
+        if (io.ConfigRenderMergeDrawLists)
+            for (ImGuiViewportP* viewport : g.Viewports)
+            {
+                const ImDrawDataBuilder* builder = &viewport->DrawDataBuilder;
+                BulletText("Merged %d lists into %d, %d draw commands into %d", builder->MergeStatsListsIn, builder->MergeStatsListsOut, builder->MergeStatsCmdsIn, builder->MergeStatsCmdsOut);
+            }
+        Checkbox("io.ConfigRenderDetectUnchangedFrames", &io.ConfigRenderDetectUnchangedFrames);
+        if (io.ConfigRenderDetectUnchangedFrames)
+            for (ImGuiViewportP* viewport : g.Viewports)
+                BulletText("Last frame content hash 0x%08X%s", viewport->DrawDataP.ContentHash, viewport->DrawDataP.Unchanged ? ", unchanged" : "");
+        Checkbox("io.ConfigTextLayoutCache", &io.ConfigTextLayoutCache);
+        if (io.ConfigTextLayoutCache)
+            BulletText("Text layouts: %d active, %d buckets", g.TextLayoutCache.LayoutsActive, g.TextLayoutCache.Buckets.Size);
         for (ImGuiViewportP* viewport : g.Viewports)
             for (ImDrawList* draw_list : viewport->DrawDataP.CmdLists)
                 DebugNodeDrawList(NULL, viewport, draw_list, "DrawList");
@@ -16697,12 +17304,35 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Profiler
+    if (TreeNode("Profiler"))
+    {
+        DebugNodeProfiler(&g.DebugProfiler);
+        TreePop();
+    }
+
     // Settings
     if (TreeNode("Memory allocations"))
     {
         ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
         Text("%d current allocations", info->TotalAllocCount - info->TotalFreeCount);
         if (SmallButton("GC now")) { g.GcCompactAll = true; }
+        if (info->SteadyStateStartFrame < 0)
+        {
+            if (SmallButton("Track steady state"))
+                DebugAllocSteadyStateBegin();
+            SameLine();
+            MetricsHelpMarker("Count allocations from next frame onward.\nA UI which doesn't change should not allocate after a few frames.");
+        }
+        else
+        {
+            if (SmallButton("Stop tracking"))
+                DebugAllocSteadyStateEnd();
+            SameLine();
+            Text("%d allocations (%d bytes) since frame %06d", info->SteadyStateAllocCount, (int)info->SteadyStateAllocBytes, info->SteadyStateStartFrame);
+            if (info->SteadyStateLastAllocFrame >= 0)
+                BulletText("Last in frame %06d <- %d frames ago", info->SteadyStateLastAllocFrame, g.FrameCount - info->SteadyStateLastAllocFrame);
+        }
         Text("Recent frames with allocations:");
         int buf_size = IM_ARRAYSIZE(info->LastEntriesBuf);
         for (int n = buf_size - 1; n >= 0; n--)
@@ -17035,14 +17665,15 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
 
         // Calculate approximate coverage area (touched pixel count)
         // This will be in pixels squared as long there's no post-scaling happening to the renderer output.
-        const ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
-        const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
+        const bool has_idx_buffer = (draw_list->IdxBuffer.Size > 0);
+        const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + (pcmd->VtxOffset - draw_list->_ArenaVtxOffset);
+        const unsigned int idx_offset = pcmd->IdxOffset - draw_list->_ArenaIdxOffset;
         float total_area = 0.0f;
-        for (unsigned int idx_n = pcmd->IdxOffset; idx_n < pcmd->IdxOffset + pcmd->ElemCount; )
+        for (unsigned int idx_n = idx_offset; idx_n < idx_offset + pcmd->ElemCount; )
         {
             ImVec2 triangle[3];
             for (int n = 0; n < 3; n++, idx_n++)
-                triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
+                triangle[n] = vtx_buffer[has_idx_buffer ? ImDrawListGetIdx(draw_list, idx_n) : idx_n].pos;
             total_area += ImTriangleArea(triangle[0], triangle[1], triangle[2]);
         }
 
@@ -17056,13 +17687,13 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         ImGuiListClipper clipper;
         clipper.Begin(pcmd->ElemCount / 3); // Manually coarse clip our print out of individual vertices to save CPU, only items that may be visible.
         while (clipper.Step())
-            for (int prim = clipper.DisplayStart, idx_i = pcmd->IdxOffset + clipper.DisplayStart * 3; prim < clipper.DisplayEnd; prim++)
+            for (int prim = clipper.DisplayStart, idx_i = idx_offset + clipper.DisplayStart * 3; prim < clipper.DisplayEnd; prim++)
             {
                 char* buf_p = buf, * buf_end = buf + IM_ARRAYSIZE(buf);
                 ImVec2 triangle[3];
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
-                    const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                    const ImDrawVert& v = vtx_buffer[has_idx_buffer ? ImDrawListGetIdx(draw_list, idx_i) : idx_i];
                     triangle[n] = v.pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
                         (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
@@ -17092,14 +17723,14 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
     ImRect vtxs_rect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
     ImDrawListFlags backup_flags = out_draw_list->Flags;
     out_draw_list->Flags &= ~ImDrawListFlags_AntiAliasedLines; // Disable AA on triangle outlines is more readable for very large and thin triangles.
-    for (unsigned int idx_n = draw_cmd->IdxOffset, idx_end = draw_cmd->IdxOffset + draw_cmd->ElemCount; idx_n < idx_end; )
+    for (unsigned int idx_n = draw_cmd->IdxOffset - draw_list->_ArenaIdxOffset, idx_end = idx_n + draw_cmd->ElemCount; idx_n < idx_end; )
     {
-        ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL; // We don't hold on those pointers past iterations as ->AddPolyline() may invalidate them if out_draw_list==draw_list
-        ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + draw_cmd->VtxOffset;
+        const bool has_idx_buffer = (draw_list->IdxBuffer.Size > 0);
+        ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + (draw_cmd->VtxOffset - draw_list->_ArenaVtxOffset); // We don't hold on those pointers past iterations as ->AddPolyline() may invalidate them if out_draw_list==draw_list
 
         ImVec2 triangle[3];
         for (int n = 0; n < 3; n++, idx_n++)
-            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
+            vtxs_rect.Add((triangle[n] = vtx_buffer[has_idx_buffer ? ImDrawListGetIdx(draw_list, idx_n) : idx_n].pos));
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
@@ -17689,6 +18320,313 @@ void ImGui::DebugTextUnformattedWithLocateItem(const char* line_begin, const cha
     }
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] DEBUG PROFILER
+//-----------------------------------------------------------------------------
+// - DebugProfilerFrameBegin() [Internal]
+// - DebugProfilerFrameEnd() [Internal]
+// - DebugProfilerScopeBegin() [Internal]
+// - DebugProfilerScopeEnd() [Internal]
+// - DebugProfilerExportChromeTrace() [Internal]
+// - DebugNodeProfiler() [Internal]
+//-----------------------------------------------------------------------------
+
+// Called at the very beginning of NewFrame(). We latch g.DebugProfiler.Enabled so a frame is either fully recorded or not at all.
+void ImGui::DebugProfilerFrameBegin()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDebugProfiler* profiler = &g.DebugProfiler;
+    if (profiler->Active)
+        DebugProfilerFrameEnd(); // Previous frame didn't reach Render()
+    if (!profiler->Enabled || g.PlatformIO.Platform_GetTimeNsFn == NULL)
+        return;
+
+    if (profiler->FramesCount > 0)
+        profiler->FrameIdx = (profiler->FrameIdx + 1) % IMGUI_DEBUG_PROFILER_HISTORY;
+    ImGuiDebugProfilerFrame* frame = &profiler->Frames[profiler->FrameIdx];
+    frame->FrameCount = g.FrameCount + 1; // NewFrame() hasn't incremented it yet
+    frame->Scopes.resize(0);
+    frame->NamesBuf.resize(0);
+    profiler->ScopeStack.resize(0);
+    profiler->Active = true;
+    frame->TimeBegin = frame->TimeEnd = g.PlatformIO.Platform_GetTimeNsFn(&g);
+}
+
+// Called at the end of Render()
+void ImGui::DebugProfilerFrameEnd()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDebugProfiler* profiler = &g.DebugProfiler;
+    if (!profiler->Active)
+        return;
+    while (profiler->ScopeStack.Size > 0) // Close scopes left open (e.g. missing End() calls)
+        DebugProfilerScopeEnd();
+    ImGuiDebugProfilerFrame* frame = &profiler->Frames[profiler->FrameIdx];
+    frame->TimeEnd = g.PlatformIO.Platform_GetTimeNsFn(&g);
+    profiler->FramesCount = ImMin(profiler->FramesCount + 1, IMGUI_DEBUG_PROFILER_HISTORY);
+    profiler->Active = false;
+}
+
+// User code may call this directly to add their own scopes to the profiler (only recorded during NewFrame()..Render())
+void ImGui::DebugProfilerScopeBegin(const char* name, ImGuiDebugProfilerScopeType type, ImGuiID id)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDebugProfiler* profiler = &g.DebugProfiler;
+    if (!profiler->Active)
+        return;
+    ImGuiDebugProfilerFrame* frame = &profiler->Frames[profiler->FrameIdx];
+    const int name_len = (int)ImStrlen(name);
+    const int name_offset = frame->NamesBuf.Size;
+    frame->NamesBuf.resize(name_offset + name_len + 1);
+    memcpy(frame->NamesBuf.Data + name_offset, name, (size_t)name_len + 1);
+
+    profiler->ScopeStack.push_back(frame->Scopes.Size);
+    frame->Scopes.resize(frame->Scopes.Size + 1);
+    ImGuiDebugProfilerScope* scope = &frame->Scopes.back();
+    scope->ID = id;
+    scope->NameOffset = name_offset;
+    scope->Depth = (ImS16)(profiler->ScopeStack.Size - 1);
+    scope->Type = (ImU8)type;
+    if (g.Hooks.Size > 0)
+    {
+        profiler->HookScope = scope;
+        CallContextHooks(&g, ImGuiContextHookType_DebugProfilerScopeBegin);
+        profiler->HookScope = NULL;
+        scope = &frame->Scopes.back();
+    }
+    scope->TimeBegin = scope->TimeEnd = g.PlatformIO.Platform_GetTimeNsFn(&g); // Sample last
+}
+
+void ImGui::DebugProfilerScopeEnd()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDebugProfiler* profiler = &g.DebugProfiler;
+    if (!profiler->Active || profiler->ScopeStack.Size == 0)
+        return;
+    const ImU64 time_end = g.PlatformIO.Platform_GetTimeNsFn(&g); // Sample first
+    ImGuiDebugProfilerFrame* frame = &profiler->Frames[profiler->FrameIdx];
+    ImGuiDebugProfilerScope* scope = &frame->Scopes[profiler->ScopeStack.back()];
+    profiler->ScopeStack.pop_back();
+    scope->TimeEnd = time_end;
+    if (g.Hooks.Size > 0)
+    {
+        profiler->HookScope = scope;
+        CallContextHooks(&g, ImGuiContextHookType_DebugProfilerScopeEnd);
+        profiler->HookScope = NULL;
+    }
+}
+
+static const char* DebugProfilerGetScopeTypeName(int type)
+{
+    const char* names[] = { "phase", "window", "table", "user" };
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(names) == ImGuiDebugProfilerScopeType_COUNT);
+    return (type >= 0 && type < ImGuiDebugProfilerScopeType_COUNT) ? names[type] : "unknown";
+}
+
+static void DebugProfilerAppendJsonString(ImGuiTextBuffer* buf, const char* s)
+{
+    buf->append("\"");
+    for (const char* p = s; *p; p++)
+    {
+        const unsigned char c = (unsigned char)*p;
+        if (c == '"' || c == '\\')
+            buf->appendf("\\%c", c);
+        else if (c < 0x20)
+            buf->appendf("\\u%04x", c);
+        else
+            buf->append(p, p + 1);
+    }
+    buf->append("\"");
+}
+
+// Export all completed frames, oldest first. Timestamps are in microseconds relative to the first exported frame.
+void ImGui::DebugProfilerExportChromeTrace(ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDebugProfiler* profiler = &g.DebugProfiler;
+    const int frames_count = profiler->GetCompletedFramesCount();
+    buf->append("{\"traceEvents\":[\n");
+    bool first_event = true;
+    const ImU64 time_origin = frames_count > 0 ? profiler->GetCompletedFrame(frames_count - 1)->TimeBegin : 0;
+    for (int frame_n = frames_count - 1; frame_n >= 0; frame_n--)
+    {
+        const ImGuiDebugProfilerFrame* frame = profiler->GetCompletedFrame(frame_n);
+        buf->appendf("%s{\"name\":\"Frame %d\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}", first_event ? "" : ",\n", frame->FrameCount, (double)(frame->TimeBegin - time_origin) / 1000.0, (double)(frame->TimeEnd - frame->TimeBegin) / 1000.0);
+        first_event = false;
+        for (const ImGuiDebugProfilerScope& scope : frame->Scopes)
+        {
+            buf->append(",\n{\"name\":");
+            DebugProfilerAppendJsonString(buf, frame->GetScopeName(&scope));
+            buf->appendf(",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%d,\"id\":\"0x%08X\"}}",
+                DebugProfilerGetScopeTypeName(scope.Type), (double)(scope.TimeBegin - time_origin) / 1000.0, (double)(scope.TimeEnd - scope.TimeBegin) / 1000.0, frame->FrameCount, scope.ID);
+        }
+    }
+    buf->append("\n],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+static float DebugProfilerGetFrameDurationMs(void* data, int idx)
+{
+    ImGuiDebugProfiler* profiler = (ImGuiDebugProfiler*)data;
+    const ImGuiDebugProfilerFrame* frame = profiler->GetCompletedFrame(profiler->GetCompletedFramesCount() - 1 - idx); // Oldest first
+    return (float)((double)(frame->TimeEnd - frame->TimeBegin) / 1000000.0);
+}
+
+static int IMGUI_CDECL DebugProfilerAggregateComparerBySelfTime(const void* lhs, const void* rhs)
+{
+    const ImGuiDebugProfilerAggregate* a = (const ImGuiDebugProfilerAggregate*)lhs;
+    const ImGuiDebugProfilerAggregate* b = (const ImGuiDebugProfilerAggregate*)rhs;
+    return (a->TimeSelf > b->TimeSelf) ? -1 : (a->TimeSelf < b->TimeSelf) ? +1 : 0;
+}
+
+void ImGui::DebugNodeProfiler(ImGuiDebugProfiler* profiler)
+{
+    ImGuiContext& g = *GImGui;
+    Checkbox("Enable recording", &profiler->Enabled);
+    SameLine();
+    MetricsHelpMarker("Record CPU time spent in NewFrame()/EndFrame()/Render() phases, windows and tables.\nUser code can add scopes with ImGui::DebugProfilerScopeBegin()/DebugProfilerScopeEnd().\nTimestamps are provided by platform_io.Platform_GetTimeNsFn().");
+    if (g.PlatformIO.Platform_GetTimeNsFn == NULL)
+        TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "platform_io.Platform_GetTimeNsFn is not set!");
+
+    const int frames_count = profiler->GetCompletedFramesCount();
+    BeginDisabled(frames_count == 0);
+    if (SmallButton("Copy Chrome trace"))
+    {
+        ImGuiTextBuffer buf;
+        DebugProfilerExportChromeTrace(&buf);
+        SetClipboardText(buf.c_str());
+    }
+#ifndef IMGUI_DISABLE_FILE_FUNCTIONS
+    SameLine();
+    if (SmallButton("Save imgui_trace.json"))
+    {
+        ImGuiTextBuffer buf;
+        DebugProfilerExportChromeTrace(&buf);
+        if (ImFileHandle f = ImFileOpen("imgui_trace.json", "wb"))
+        {
+            ImFileWrite(buf.c_str(), sizeof(char), (ImU64)buf.size(), f);
+            ImFileClose(f);
+        }
+    }
+#endif
+    EndDisabled();
+    SameLine();
+    MetricsHelpMarker("Load in chrome://tracing or https://ui.perfetto.dev");
+    if (frames_count == 0)
+        return;
+
+    // Frame durations (oldest to newest). Click to select a frame.
+    PlotLines("##FrameTimes", DebugProfilerGetFrameDurationMs, profiler, frames_count, 0, "Frame time (ms)", 0.0f, FLT_MAX, ImVec2(-FLT_MIN, GetTextLineHeight() * 3.0f));
+    profiler->DisplayFrameOffset = ImClamp(profiler->DisplayFrameOffset, 0, frames_count - 1);
+    SetNextItemWidth(-FLT_MIN);
+    SliderInt("##FrameOffset", &profiler->DisplayFrameOffset, frames_count - 1, 0, "%d frames ago", ImGuiSliderFlags_AlwaysClamp);
+    const ImGuiDebugProfilerFrame* frame = profiler->GetCompletedFrame(profiler->DisplayFrameOffset);
+    const double frame_duration_ms = (double)(frame->TimeEnd - frame->TimeBegin) / 1000000.0;
+    Text("Frame %d: %.3f ms, %d scopes", frame->FrameCount, frame_duration_ms, frame->Scopes.Size);
+
+    // Flame graph: one row per depth level
+    int max_depth = 0;
+    for (const ImGuiDebugProfilerScope& scope : frame->Scopes)
+        max_depth = ImMax(max_depth, (int)scope.Depth);
+    const float row_height = GetTextLineHeight() + 2.0f;
+    const ImVec2 graph_size(GetContentRegionAvail().x, row_height * (max_depth + 1));
+    const ImVec2 graph_pos = GetCursorScreenPos();
+    const ImRect graph_bb(graph_pos, graph_pos + graph_size);
+    InvisibleButton("##FlameGraph", graph_size);
+    ImDrawList* draw_list = GetWindowDrawList();
+    draw_list->AddRectFilled(graph_bb.Min, graph_bb.Max, GetColorU32(ImGuiCol_FrameBg));
+    const ImU32 type_colors[] = { IM_COL32(90, 90, 200, 255), IM_COL32(60, 150, 60, 255), IM_COL32(170, 120, 40, 255), IM_COL32(150, 60, 150, 255) };
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(type_colors) == ImGuiDebugProfilerScopeType_COUNT);
+    const double scale = (frame->TimeEnd > frame->TimeBegin) ? graph_size.x / (double)(frame->TimeEnd - frame->TimeBegin) : 0.0;
+    const bool graph_hovered = IsItemHovered();
+    const ImGuiDebugProfilerScope* hovered_scope = NULL;
+    for (const ImGuiDebugProfilerScope& scope : frame->Scopes)
+    {
+        ImRect scope_bb;
+        scope_bb.Min.x = graph_bb.Min.x + (float)((double)(scope.TimeBegin - frame->TimeBegin) * scale);
+        scope_bb.Max.x = ImMax(graph_bb.Min.x + (float)((double)(scope.TimeEnd - frame->TimeBegin) * scale), scope_bb.Min.x + 1.0f);
+        scope_bb.Min.y = graph_bb.Min.y + scope.Depth * row_height;
+        scope_bb.Max.y = scope_bb.Min.y + row_height - 1.0f;
+        if (graph_hovered && scope_bb.Contains(g.IO.MousePos))
+            hovered_scope = &scope;
+        draw_list->AddRectFilled(scope_bb.Min, scope_bb.Max, (hovered_scope == &scope) ? GetColorU32(ImGuiCol_ButtonHovered) : type_colors[scope.Type]);
+        if (scope_bb.GetWidth() > g.FontSize * 2.0f)
+            RenderTextEllipsis(draw_list, scope_bb.Min + ImVec2(2.0f, 1.0f), ImVec2(scope_bb.Max.x - 2.0f, scope_bb.Max.y), scope_bb.Max.x - 2.0f, frame->GetScopeName(&scope), NULL, NULL);
+    }
+    if (hovered_scope != NULL)
+    {
+        const double duration_ms = (double)(hovered_scope->TimeEnd - hovered_scope->TimeBegin) / 1000000.0;
+        SetTooltip("%s (%s)\n%.3f ms, %.1f%% of frame", frame->GetScopeName(hovered_scope), DebugProfilerGetScopeTypeName(hovered_scope->Type), duration_ms, frame_duration_ms > 0.0 ? duration_ms * 100.0 / frame_duration_ms : 0.0);
+        if (hovered_scope->Type == ImGuiDebugProfilerScopeType_Window)
+            if (ImGuiWindow* window = FindWindowByID(hovered_scope->ID))
+                GetForegroundDrawList(window)->AddRect(window->Pos, window->Pos + window->Size, IM_COL32(255, 255, 0, 255));
+    }
+
+    // Aggregated timings, sorted by self time (total time minus time of child scopes)
+    // (buffers are kept in ImGuiDebugProfiler so that keeping this node open doesn't allocate every frame)
+    ImVector<ImGuiDebugProfilerAggregate>& aggregates = profiler->MetricsAggregates;
+    ImGuiStorage& aggregates_map = profiler->MetricsAggregatesMap;
+    ImVector<int>& parent_stack = profiler->MetricsParentStack;
+    aggregates.resize(0);
+    aggregates_map.Data.resize(0);
+    parent_stack.resize(0);
+    for (int scope_n = 0; scope_n < frame->Scopes.Size; scope_n++)
+    {
+        const ImGuiDebugProfilerScope* scope = &frame->Scopes[scope_n];
+        const ImU64 duration = scope->TimeEnd - scope->TimeBegin;
+        ImGuiID key = scope->ID ? scope->ID : ImHashStr(frame->GetScopeName(scope));
+        key = ImHashData(&scope->Type, sizeof(scope->Type), key);
+        int* p_idx = aggregates_map.GetIntRef(key, -1);
+        if (*p_idx == -1)
+        {
+            *p_idx = aggregates.Size;
+            ImGuiDebugProfilerAggregate new_aggregate = { scope_n, 0, 0, 0 };
+            aggregates.push_back(new_aggregate);
+        }
+        aggregates[*p_idx].Count++;
+        aggregates[*p_idx].TimeTotal += duration;
+        aggregates[*p_idx].TimeSelf += duration;
+        parent_stack.resize(scope->Depth);
+        if (scope->Depth > 0 && parent_stack.Size > 0)
+        {
+            const ImGuiDebugProfilerScope* parent_scope = &frame->Scopes[parent_stack.back()];
+            ImGuiID parent_key = parent_scope->ID ? parent_scope->ID : ImHashStr(frame->GetScopeName(parent_scope));
+            parent_key = ImHashData(&parent_scope->Type, sizeof(parent_scope->Type), parent_key);
+            ImGuiDebugProfilerAggregate* parent_aggregate = &aggregates[aggregates_map.GetInt(parent_key)];
+            parent_aggregate->TimeSelf = (parent_aggregate->TimeSelf > duration) ? parent_aggregate->TimeSelf - duration : 0;
+        }
+        parent_stack.push_back(scope_n);
+    }
+    if (aggregates.Size > 1)
+        ImQsort(aggregates.Data, (size_t)aggregates.Size, sizeof(ImGuiDebugProfilerAggregate), DebugProfilerAggregateComparerBySelfTime);
+
+    if (BeginTable("##Aggregates", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 12)))
+    {
+        TableSetupScrollFreeze(0, 1);
+        TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+        TableSetupColumn("Type");
+        TableSetupColumn("Count");
+        TableSetupColumn("Total ms");
+        TableSetupColumn("Self ms");
+        TableHeadersRow();
+        for (const ImGuiDebugProfilerAggregate& aggregate : aggregates)
+        {
+            const ImGuiDebugProfilerScope* scope = &frame->Scopes[aggregate.ScopeIdx];
+            TableNextRow();
+            TableNextColumn();
+            TextUnformatted(frame->GetScopeName(scope));
+            TableNextColumn();
+            TextUnformatted(DebugProfilerGetScopeTypeName(scope->Type));
+            TableNextColumn();
+            Text("%d", aggregate.Count);
+            TableNextColumn();
+            Text("%.3f", (double)aggregate.TimeTotal / 1000000.0);
+            TableNextColumn();
+            Text("%.3f", (double)aggregate.TimeSelf / 1000000.0);
+        }
+        EndTable();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, ID STACK TOOL)
 //-----------------------------------------------------------------------------
@@ -17985,6 +18923,8 @@ void ImGui::ShowIDStackToolWindow(bool* p_open)
 
     // Ctrl+C to copy path
     const float time_since_copy = (float)g.Time - tool->CopyToClipboardLastTime;
+    if (time_since_copy >= 0.0f && time_since_copy < 0.75f)
+        RequestNextFrame();
     PushStyleVarY(ImGuiStyleVar_FramePadding, 0.0f);
     Checkbox("Hex-encode non-ASCII", &tool->OptHexEncodeNonAsciiChars);
     SameLine();
@@ -18046,6 +18986,13 @@ void ImGui::DebugNodeWindowSettings(ImGuiWindowSettings*) {}
 void ImGui::DebugNodeWindowsList(ImVector<ImGuiWindow*>*, const char*) {}
 void ImGui::DebugNodeViewport(ImGuiViewportP*) {}
 
+void ImGui::DebugProfilerFrameBegin() {}
+void ImGui::DebugProfilerFrameEnd() {}
+void ImGui::DebugProfilerScopeBegin(const char*, ImGuiDebugProfilerScopeType, ImGuiID) {}
+void ImGui::DebugProfilerScopeEnd() {}
+void ImGui::DebugProfilerExportChromeTrace(ImGuiTextBuffer*) {}
+void ImGui::DebugNodeProfiler(ImGuiDebugProfiler*) {}
+
 void ImGui::ShowDebugLogWindow(bool*) {}
 void ImGui::ShowIDStackToolWindow(bool*) {}
 void ImGui::DebugStartItemPicker() {}
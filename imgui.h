@@ -48,7 +48,7 @@ Index of this file:
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
 // [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage)
-// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData, ImDrawDataTileTracker)
 // [SECTION] Texture API (ImTextureFormat, ImTextureStatus, ImTextureRect, ImTextureData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFontBaked, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -170,7 +170,9 @@ typedef unsigned long long  ImU64;  // 64-bit unsigned integer
 struct ImDrawChannel;               // Temporary storage to output draw commands out of order, used by ImDrawListSplitter and ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
+struct ImDrawDataTileTracker;       // Helper to find which screen tiles of a ImDrawData changed since previous frame (e.g. to only redraw or transmit those)
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
+struct ImDrawListFragment;          // Cached output of a sequence of ImDrawList calls, which may be appended again with an offset (see ImDrawList::FragmentBegin/FragmentEnd/AddFragment)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
@@ -1027,11 +1029,26 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetBackgroundDrawList();                                            // this draw list will be the first rendered one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList();                                            // this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
 
+    // Multi-threaded Draw Lists
+    // - Fill your own ImDrawList instances from worker threads, and register them with AddWindowDrawList() from the main thread to render them along a window.
+    // - Each worker thread needs its own ImDrawListSharedData (it holds scratch buffers): create one per thread with CreateDrawListSharedData(),
+    //   and call UpdateDrawListSharedData() from the main thread every frame, after NewFrame() and before starting jobs.
+    // - In a job: call ResetWorkerDrawList(draw_list), then submit shapes.
+    // - Jobs need to be completed before Render(). Render order is the order of AddWindowDrawList() calls, regardless of when jobs complete.
+    // - Worker threads must not call any other ImGui:: function, and must not use ImDrawList::AddText(): fonts load glyphs on demand. Submit text to the window's draw list.
+    // - Allocations made from worker threads are not recorded by debug tools (Metrics->Memory allocations, DebugAllocSteadyStateBegin()).
+    IMGUI_API ImDrawListSharedData* CreateDrawListSharedData();                                 // create a ImDrawListSharedData for ImDrawList instances filled by a worker thread.
+    IMGUI_API void          DestroyDrawListSharedData(ImDrawListSharedData* data);              // all ImDrawList using it need to be destroyed first.
+    IMGUI_API void          UpdateDrawListSharedData(ImDrawListSharedData* data);               // copy current context settings (texture coordinates, tessellation, flags) into 'data'. call from main thread.
+    IMGUI_API void          ResetWorkerDrawList(ImDrawList* draw_list);                         // clear 'draw_list' and push full-screen clip rect + font atlas texture. call from the worker thread, at the beginning of a job.
+    IMGUI_API void          AddWindowDrawList(ImDrawList* draw_list);                           // render 'draw_list' right after current window's draw list, before its child windows. may still be filled until Render() is called.
+
     // Miscellaneous Utilities
     IMGUI_API bool          IsRectVisible(const ImVec2& size);                                  // test if rectangle (of given size, starting from cursor position) is visible / not clipped.
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API void          RequestNextFrame(float delay = 0.0f);                               // request a new frame within 'delay' seconds, for applications sleeping until io.NextFrameDeadline. call every frame while running your own animations.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
@@ -1719,6 +1736,7 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
     ImGuiBackendFlags_RendererHasTextures   = 1 << 4,   // Backend Renderer supports ImTextureData requests to create/update/destroy textures. This enables incremental texture updates and texture reloads. See https://github.com/ocornut/imgui/blob/master/docs/BACKENDS.md for instructions on how to upgrade your custom backend.
+    ImGuiBackendFlags_RendererHasIdxSize    = 1 << 5,   // Backend Renderer reads index size from ImDrawData::IdxSize instead of sizeof(ImDrawIdx). When ImDrawIdx is 32-bit, Render() packs indices to 16-bit for draw data where every draw list has 64K vertices or less.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2325,6 +2343,7 @@ struct ImGuiStyle
     bool        AntiAliasedLines;           // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedLinesUseTex;     // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering). Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedFill;            // Enable anti-aliased edges around filled shapes (rounded rectangles, circles, etc.). Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
+    bool        AntiAliasedFillUseTex;      // Enable anti-aliased filled rounded rectangles and circles using textures where possible (fewer vertices). Require backend to render with bilinear filtering (NOT point/nearest filtering). Latched at the beginning of the frame (copied to ImDrawList).
     float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     float       CircleTessellationMaxError; // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
 
@@ -2418,6 +2437,9 @@ struct ImGuiIO
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] Ctrl+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigRenderMergeDrawLists;     // = false          // [EXPERIMENTAL] Render() concatenates consecutive draw lists and merges their draw commands when texture matches and clipping is equivalent, reducing draw calls (e.g. many small windows) at the cost of copying vertices. Lists with callbacks are left untouched.
+    bool        ConfigRenderDetectUnchangedFrames; // = false       // Render() hashes contents of each viewport's ImDrawData and sets ImDrawData::Unchanged when identical to previous frame, so application/backends may skip uploading, rendering and presenting it. Never set when draw data has user callbacks or textures need updating.
+    bool        ConfigTextLayoutCache;          // = false          // [EXPERIMENTAL] Cache size and glyph positions of texts measured by CalcTextSize() and drawn by ImDrawList::AddText(), keyed by contents, font, size and wrap width. Helps with many mostly-static labels, long (16 to 256 bytes) or wrapped ones. Unused layouts are discarded after 60 frames.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2526,6 +2548,7 @@ struct ImGuiIO
     bool        WantSaveIniSettings;                // When manual .ini load/save is active (io.IniFilename == NULL), this will be set to notify your application that you can call SaveIniSettingsToMemory() and save yourself. Important: clear io.WantSaveIniSettings yourself after saving!
     bool        NavActive;                          // Keyboard/Gamepad navigation is currently allowed (will handle ImGuiKey_NavXXX events) = a window is focused and it doesn't use the ImGuiWindowFlags_NoNavInputs flag.
     bool        NavVisible;                         // Keyboard/Gamepad navigation highlight is visible and allowed (will handle ImGuiKey_NavXXX events).
+    double      NextFrameDeadline;                  // Set by EndFrame(): time (in ImGui::GetTime() units) by which a new frame is needed if no new input events arrive, for blinking cursor, tooltip delays, animations, pending updates, key repeat etc. <= GetTime() when needed immediately (e.g. after processing inputs), FLT_MAX when nothing is pending. Applications may sleep until new events arrive or (NextFrameDeadline - GetTime()) seconds have elapsed, instead of rendering continuously.
     float       Framerate;                          // Estimate of application framerate (rolling average over 60 frames, based on io.DeltaTime), in frame per second. Solely for convenience. Slow applications may not want to use a moving average or may want to reset underlying buffers occasionally.
     int         MetricsRenderVertices;              // Vertices output during last call to Render()
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
@@ -3099,7 +3122,7 @@ struct ImGuiSelectionExternalStorage
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData, ImDrawDataTileTracker)
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
 //-----------------------------------------------------------------------------
 
@@ -3108,6 +3131,11 @@ struct ImGuiSelectionExternalStorage
 #define IM_DRAWLIST_TEX_LINES_WIDTH_MAX     (32)
 #endif
 
+// The maximum radius to bake anti-aliased rounded corners textures for. Build atlas with ImFontAtlasFlags_NoBakedCorners to disable baking.
+#ifndef IM_DRAWLIST_TEX_CORNERS_RADIUS_MAX
+#define IM_DRAWLIST_TEX_CORNERS_RADIUS_MAX  (32)
+#endif
+
 // ImDrawIdx: vertex index. [Compile-time configurable type]
 // - To use 16-bit indices + allow large meshes: backend need to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset' and handle ImDrawCmd::VtxOffset (recommended).
 // - To use 32-bit indices: override with '#define ImDrawIdx unsigned int' in your imconfig.h file.
@@ -3189,21 +3217,48 @@ struct ImDrawChannel
 
 // Split/Merge functions are used to split the draw list into different layers which can be drawn into out of order.
 // This is used by the Columns/Tables API, so items of each column can be batched together in a same draw call.
+// - Merge() may be given an order in which to flatten channels (e.g. to group channels sharing a same clip rectangle).
+// - Calling Split() while already split starts a nested level within the current channel, flattened back by the matching Merge().
 struct ImDrawListSplitter
 {
-    int                         _Current;    // Current channel number (0)
-    int                         _Count;      // Number of active channels (1+)
+    int                         _Current;    // Current channel number (0), relative to _Base
+    int                         _Count;      // Number of active channels (1+) in current level
+    int                         _Base;       // Index of current level channel 0 in _Channels[] (0 unless nested)
     ImVector<ImDrawChannel>     _Channels;   // Draw channels (not resized down so _Count might be < Channels.Size)
+    ImVector<int>               _Parents;    // _Current/_Count pairs of parent levels when Split() calls are nested
 
     inline ImDrawListSplitter()  { memset(this, 0, sizeof(*this)); }
     inline ~ImDrawListSplitter() { ClearFreeMemory(); }
-    inline void                 Clear() { _Current = 0; _Count = 1; } // Do not clear Channels[] so our allocations are reused next frame
+    inline void                 Clear() { _Current = 0; _Count = 1; _Base = 0; _Parents.resize(0); } // Do not clear Channels[] so our allocations are reused next frame
     IMGUI_API void              ClearFreeMemory();
     IMGUI_API void              Split(ImDrawList* draw_list, int count);
-    IMGUI_API void              Merge(ImDrawList* draw_list);
+    IMGUI_API void              Merge(ImDrawList* draw_list, const int* channels_order = NULL); // channels_order[]: optional, _Count channel indices starting with 0.
     IMGUI_API void              SetCurrentChannel(ImDrawList* draw_list, int channel_idx);
 };
 
+// Cached output of a sequence of ImDrawList calls (vertices, indices, draw commands, textures).
+// Record once with ImDrawList::FragmentBegin()/FragmentEnd(), then append again on following frames with ImDrawList::AddFragment(), skipping all tessellation.
+// - AddFragment() translates vertices and clip rectangles by an offset, and intersects clip rectangles with the current one.
+//   Other transforms may be applied on the appended vertices using ImGui::ShadeVertsTransformPos().
+// - UV coordinates are bound to the font atlas texture at the time of recording: record again when IsValid() returns false (e.g. atlas texture was resized).
+// - Callbacks and changing channels (ImDrawListSplitter) while recording are not supported.
+// - Typical use: static grids, node editor wires, labels.
+struct ImDrawListFragment
+{
+    ImVector<ImDrawCmd>         CmdBuffer;      // Draw commands. VtxOffset/IdxOffset are relative to this fragment's buffers, ClipRect is the one used during recording.
+    ImVector<ImDrawIdx>         IdxBuffer;      // Index buffer.
+    ImVector<ImDrawVert>        VtxBuffer;      // Vertex buffer.
+    int                         AtlasTexUniqueID; // Font atlas TexData->UniqueID at the time of recording (-1 if none). Not a pointer: a new texture may be allocated at the address of a destroyed one.
+    ImVector<int>               AtlasPagesTexUniqueIDs; // UniqueID of font atlas texture pages used by recorded commands (ImFontAtlasFlags_MultiPage). Pages may be released while the atlas main texture stays.
+    bool                        Recorded;       // Set by FragmentEnd(). May be recorded and still empty (e.g. everything was clipped).
+    int                         _VtxStart;      // [Internal] Source VtxBuffer.Size when recording started, -1 when not recording.
+    int                         _IdxStart;      // [Internal] Source IdxBuffer.Size when recording started.
+
+    ImDrawListFragment()        { AtlasTexUniqueID = -1; Recorded = false; _VtxStart = _IdxStart = -1; }
+    void                        Clear() { CmdBuffer.resize(0); IdxBuffer.resize(0); VtxBuffer.resize(0); AtlasTexUniqueID = -1; AtlasPagesTexUniqueIDs.resize(0); Recorded = false; _VtxStart = _IdxStart = -1; } // Keep allocations
+    IMGUI_API bool              IsValid(const ImDrawList* draw_list) const; // Recorded and can be appended to 'draw_list'.
+};
+
 // Flags for ImDrawList functions
 // (Legacy: bit 0 must always correspond to ImDrawFlags_Closed to be backward compatible with old API using a bool. Bits 1..3 must be unused)
 enum ImDrawFlags_
@@ -3233,6 +3288,7 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AntiAliasedFillUseTex   = 1 << 4,  // Enable anti-aliased rounded rectangles and circles using textures when possible (fewer vertices). Require backend to render with bilinear filtering (NOT point/nearest filtering).
 };
 
 // Draw command list
@@ -3264,6 +3320,8 @@ struct ImDrawList
     ImVector<ImTextureRef>  _TextureStack;      // [Internal]
     ImVector<ImU8>          _CallbacksDataBuf;  // [Internal]
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
+    unsigned int            _ArenaVtxOffset;    // [Internal] amount added to ImDrawCmd::VtxOffset by ImDrawData::ExportToArena() (0 otherwise)
+    unsigned int            _ArenaIdxOffset;    // [Internal] amount added to ImDrawCmd::IdxOffset by ImDrawData::ExportToArena() (0 otherwise)
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData().
@@ -3306,11 +3364,21 @@ struct ImDrawList
     IMGUI_API void  AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness, int num_segments = 0);               // Quadratic Bezier (3 control points)
 
     // General polygon
-    // - Only simple polygons are supported by filling functions (no self-intersections, no holes).
-    // - Concave polygon fill is more expensive than convex one: it has O(N^2) complexity. Provided as a convenience for the user but not used by the main library.
+    // - Only simple polygons are supported by filling functions (no self-intersections). Holes are only supported by AddConcavePolyFilled().
+    // - Concave polygon fill is more expensive than convex one: it has O(N log N) complexity. Provided as a convenience for the user but not used by the main library.
     IMGUI_API void  AddPolyline(const ImVec2* points, int num_points, ImU32 col, ImDrawFlags flags, float thickness);
     IMGUI_API void  AddConvexPolyFilled(const ImVec2* points, int num_points, ImU32 col);
     IMGUI_API void  AddConcavePolyFilled(const ImVec2* points, int num_points, ImU32 col);
+    IMGUI_API void  AddConcavePolyFilled(const ImVec2* points, const int* contours_num_points, int contours_count, ImU32 col); // Points of all contours stored one after the other. First contour is the outer boundary, following ones are holes. Any winding order.
+
+    // Batched primitives
+    // - Equivalent to calling AddRectFilled()/AddLine()/AddCircleFilled() once per instance, but flags and state are only checked once
+    //   and vertices/indices are reserved once for the whole batch. Prefer those when submitting thousands of shapes (e.g. heatmaps, timelines).
+    // - Each array holds 'count' elements. Instances with a fully transparent color are skipped.
+    // - Output is the same as individual calls, only draw commands may be split at different places when using 16-bit indices.
+    IMGUI_API void  AddRectFilledBatch(const ImVec2* p_min, const ImVec2* p_max, const ImU32* cols, int count, float rounding = 0.0f, ImDrawFlags flags = 0);
+    IMGUI_API void  AddLineBatch(const ImVec2* p1, const ImVec2* p2, const ImU32* cols, int count, float thickness = 1.0f);
+    IMGUI_API void  AddCircleFilledBatch(const ImVec2* centers, const float* radii, const ImU32* cols, int count, int num_segments = 0);
 
     // Image primitives
     // - Read FAQ to understand what ImTextureID/ImTextureRef are.
@@ -3350,6 +3418,7 @@ struct ImDrawList
     // Advanced: Miscellaneous
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer. For multi-threaded rendering, consider using `imgui_threaded_rendering` from https://github.com/ocornut/imgui_club instead.
+    IMGUI_API ImU32 CalcContentHash() const;                                    // Hash CmdBuffer/IdxBuffer/VtxBuffer contents. Equal hashes mean identical output (ImDrawCmd offsets rebased by ImDrawData::ExportToArena() are hashed relative to this list).
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -3361,6 +3430,13 @@ struct ImDrawList
     inline void     ChannelsMerge()             { _Splitter.Merge(this); }
     inline void     ChannelsSetCurrent(int n)   { _Splitter.SetCurrentChannel(this, n); }
 
+    // Advanced: Cached fragments
+    // - Record the output of all calls between FragmentBegin() and FragmentEnd() into a ImDrawListFragment. Output is also emitted normally into this draw list.
+    // - AddFragment() appends a recorded fragment translated by 'offset', clipped by the current clip rectangle. Fully clipped draw commands are skipped.
+    IMGUI_API void  FragmentBegin(ImDrawListFragment* fragment);
+    IMGUI_API void  FragmentEnd(ImDrawListFragment* fragment);
+    IMGUI_API void  AddFragment(const ImDrawListFragment& fragment, const ImVec2& offset = ImVec2(0.0f, 0.0f));
+
     // Advanced: Primitives allocations
     // - We render triangles (three vertices)
     // - All primitives needs to be reserved via PrimReserve() beforehand.
@@ -3397,6 +3473,8 @@ struct ImDrawList
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
+    IMGUI_API void  _PathAddCachedPoints(const ImVec2& origin, const ImVector<ImVec2>& points);
+    IMGUI_API void  _PrimConvexPolyFilled(const ImVec2* points, int points_count, ImU32 col);
 };
 
 // All draw data to render a Dear ImGui frame
@@ -3408,11 +3486,16 @@ struct ImDrawData
     int                 CmdListsCount;      // == CmdLists.Size. (OBSOLETE: exists for legacy reasons). Number of ImDrawList* to render.
     int                 TotalIdxCount;      // For convenience, sum of all ImDrawList's IdxBuffer.Size
     int                 TotalVtxCount;      // For convenience, sum of all ImDrawList's VtxBuffer.Size
+    int                 IdxSize;            // Size of each index in ImDrawList's IdxBuffer, in bytes: 2 or 4. == sizeof(ImDrawIdx) unless PackIndexBuffers() converted them. Backends setting ImGuiBackendFlags_RendererHasIdxSize must use this for index type, strides and uploads sizes.
     ImVector<ImDrawList*> CmdLists;         // Array of ImDrawList* to render. The ImDrawLists are owned by ImGuiContext and only pointed to from here.
     ImVec2              DisplayPos;         // Top-left position of the viewport to render (== top-left of the orthogonal projection matrix to use) (== GetMainViewport()->Pos for the main viewport, == (0.0) in most single-viewport applications)
     ImVec2              DisplaySize;        // Size of the viewport to render (== GetMainViewport()->Size for the main viewport, == io.DisplaySize in most single-viewport applications)
     ImVec2              FramebufferScale;   // Amount of pixels for each unit of DisplaySize. Copied from viewport->FramebufferScale (== io.DisplayFramebufferScale for main viewport). Generally (1,1) on normal display, (2,2) on OSX with Retina display.
     ImGuiViewport*      OwnerViewport;      // Viewport carrying the ImDrawData instance, might be of use to the renderer (generally not).
+    ImDrawVert*         ArenaVtxBuffer;     // != NULL after ExportToArena(): all vertices were written there, and each ImDrawCmd::VtxOffset is relative to it (draw with base vertex = VtxOffset).
+    void*               ArenaIdxBuffer;     // != NULL after ExportToArena(): all indices (of IdxSize bytes) were written there, and each ImDrawCmd::IdxOffset is relative to it.
+    ImU32               ContentHash;        // Hash of draw lists contents + display parameters, set by Render() when io.ConfigRenderDetectUnchangedFrames is enabled (0 otherwise).
+    bool                Unchanged;          // Set by Render() when io.ConfigRenderDetectUnchangedFrames is enabled and ContentHash matches previous frame of the same viewport: output would be identical to what was last rendered, you may skip uploading/rendering/presenting it.
     ImVector<ImTextureData*>* Textures;     // List of textures to update. Most of the times the list is shared by all ImDrawData, has only 1 texture and it doesn't need any update. This almost always points to ImGui::GetPlatformIO().Textures[]. May be overridden or set to NULL if you want to manually update textures.
 
     // Functions
@@ -3420,7 +3503,37 @@ struct ImDrawData
     IMGUI_API void  Clear();
     IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData.
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
+    IMGUI_API bool  PackIndexBuffers();                     // Helper to convert 32-bit indices to 16-bit in place, halving index bandwidth. Only when ImDrawIdx is 32-bit and every draw list has 64K vertices or less. Return true and set IdxSize = 2 on success. Called by Render() if backend sets ImGuiBackendFlags_RendererHasIdxSize.
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API void  CopyAllBuffers(ImDrawVert* vtx_dst, void* idx_dst); // Helper to copy all vertices and indices into contiguous buffers (e.g. mapped upload buffers), in CmdLists[] order. 'vtx_dst' needs room for TotalVtxCount vertices, 'idx_dst' for TotalIdxCount * IdxSize bytes.
+    IMGUI_API void  ExportToArena(ImDrawVert* vtx_dst, void* idx_dst);  // Helper to CopyAllBuffers() then rebase ImDrawCmd::VtxOffset/IdxOffset on start of 'vtx_dst'/'idx_dst', and set ArenaVtxBuffer/ArenaIdxBuffer. Called by Render() when platform_io.Renderer_GetDrawDataArenaFn is set.
+    IMGUI_API ImU32 CalcContentHash() const;                // Helper to hash contents of all draw lists (see ImDrawList::CalcContentHash(), lists are hashed in parallel using platform_io.Platform_ParallelForFn when set) + DisplayPos/DisplaySize/FramebufferScale.
+};
+
+// Find which screen tiles of a ImDrawData changed since previous call to Update(), e.g. to only redraw or transmit those (remote display, video encoders).
+// Keep one instance per viewport and call Update() after Render(), every frame.
+// - Tiles are square, in framebuffer pixels (DisplaySize * FramebufferScale). Tile index = tile_y * TilesX + tile_x.
+// - Each tile contents is identified by hashing, in draw order, texture identifiers + clip rectangles + vertices of all triangles overlapping it.
+//   This is conservative: a tile may be reported when its pixels end up identical, but a tile whose pixels changed is always reported.
+// - Changes in texture contents are not detected: call Invalidate() after modifying a texture in use (font atlas updates only write to unused regions).
+// - Draw callbacks may draw anything: all tiles are reported dirty when draw data has any (except ImDrawCallback_ResetRenderState).
+// - Cost is a single pass over all triangles, each hashed once. This is typically much cheaper than rasterizing or encoding tiles.
+struct ImDrawDataTileTracker
+{
+    int                 TileSize;           // Width and height of a tile, in pixels. Default to 64. Changing it makes all tiles dirty.
+    int                 TilesX, TilesY;     // Number of tiles, set by Update().
+    ImVector<ImU32>     TileHashes;         // [TilesX * TilesY] Hash of each tile contents, set by Update().
+    ImVector<int>       DirtyTiles;         // Index of tiles which changed, set by Update(). All tiles on first frame or after resize/Invalidate().
+    ImVector<ImU32>     _PrevTileHashes;    // [Internal]
+    ImVec2              _DisplayPos;        // [Internal] Values used by previous Update()
+    ImVec2              _FramebufferScale;  // [Internal]
+    ImVec2              _FramebufferSize;   // [Internal]
+    int                 _PrevTileSize;      // [Internal]
+
+    ImDrawDataTileTracker()         { TileSize = 64; TilesX = TilesY = 0; _PrevTileSize = 0; }
+    void            Invalidate()    { TileHashes.clear(); }
+    IMGUI_API int   Update(ImDrawData* draw_data);  // Hash tiles, compare with previous call and fill DirtyTiles[]. Return DirtyTiles.Size.
+    IMGUI_API void  GetTileRect(int tile_n, ImVec2* out_min, ImVec2* out_max) const; // Rectangle covered by a tile, in framebuffer pixels, clamped to framebuffer size.
 };
 
 //-----------------------------------------------------------------------------
@@ -3556,10 +3669,11 @@ struct ImFontGlyph
     unsigned int    Colored : 1;        // Flag to indicate glyph is colored and should generally ignore tinting (make it usable with no shift on little-endian as this is used in loops)
     unsigned int    Visible : 1;        // Flag to indicate glyph has no visible pixels (e.g. space). Allow early out when rendering.
     unsigned int    SourceIdx : 4;      // Index of source in parent font
-    unsigned int    Codepoint : 26;     // 0x0000..0x10FFFF
+    unsigned int    Codepoint : 21;     // 0x0000..0x10FFFF
+    unsigned int    PageIndex : 5;      // Texture page. 0 for ImFontAtlas->TexRef, otherwise see ImFontAtlasFlags_MultiPage.
     float           AdvanceX;           // Horizontal distance to advance cursor/layout position.
     float           X0, Y0, X1, Y1;     // Glyph corners. Offsets from current cursor/layout position.
-    float           U0, V0, U1, V1;     // Texture coordinates for the current value of ImFontAtlas->TexRef. Cached equivalent of calling GetCustomRect() with PackId.
+    float           U0, V0, U1, V1;     // Texture coordinates for the current value of ImFontAtlas->TexRef (or texture page). Cached equivalent of calling GetCustomRect() with PackId.
     int             PackId;             // [Internal] ImFontAtlasRectId value (FIXME: Cold data, could be moved elsewhere?)
 
     ImFontGlyph()   { memset(this, 0, sizeof(*this)); PackId = -1; }
@@ -3605,6 +3719,9 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedCorners     = 1 << 3,   // Don't build rounded corners textures into the atlas (save a little texture memory). The AntiAliasedFillUseTex features uses them, otherwise rounded shapes will be rendered using polygons.
+    ImFontAtlasFlags_AsyncGlyphLoad     = 1 << 4,   // [Experimental] Rasterize new glyphs on worker threads using platform_io.Platform_AsyncJobStartFn/Platform_AsyncJobWaitFn. Glyphs are laid out with their final advance but drawn blank until ready (usually next frame). Requires ImGuiBackendFlags_RendererHasTextures and a font loader supporting it (stb_truetype).
+    ImFontAtlasFlags_MultiPage          = 1 << 5,   // [Experimental] Once the main texture reached TexPageSize, add glyphs to extra fixed-size textures instead of growing and repacking it. Glyphs on other pages are submitted as separate draw commands. Requires ImGuiBackendFlags_RendererHasTextures.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3642,6 +3759,16 @@ struct ImFontAtlas
     IMGUI_API void              CompactCache();             // Compact cached glyphs and texture.
     IMGUI_API void              SetFontLoader(const ImFontLoader* font_loader); // Change font loader at runtime.
 
+    // [EXPERIMENTAL] Persistent glyph cache, to skip rasterizing glyphs at startup.
+    // - Save before shutdown, load after adding fonts: glyphs of all font sizes used by the previous run are added back with their pixels.
+    // - Fonts are only matched when their TTF data and ImFontConfig settings are unchanged. Other glyphs are loaded normally.
+    // - Data is only valid for the same font loader, texture format and TexGlyphPadding value, and in the same byte order.
+    // - Loading returns false and leaves the atlas untouched if data is truncated, corrupted or was saved with a different texture format/padding.
+    IMGUI_API bool              SaveCacheToFile(const char* filename);
+    IMGUI_API bool              LoadCacheFromFile(const char* filename);
+    IMGUI_API bool              SaveCacheToMemory(ImVector<unsigned char>* out_data);
+    IMGUI_API bool              LoadCacheFromMemory(const void* data, size_t data_size);
+
     // As we are transitioning toward a new font system, we expect to obsolete those soon:
     IMGUI_API void              ClearInputData();           // [OBSOLETE] Clear input data (all ImFontConfig structures including sizes, TTF data, glyph ranges, etc.) = all the data used to build the texture and fonts.
     IMGUI_API void              ClearFonts();               // [OBSOLETE] Clear input+output font data (same as ClearInputData() + glyphs storage, UV coordinates).
@@ -3722,6 +3849,7 @@ struct ImFontAtlas
     int                         TexMinHeight;       // Minimum desired texture height. Must be a power of two. Default to 128.
     int                         TexMaxWidth;        // Maximum desired texture width. Must be a power of two. Default to 8192.
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
+    int                         TexPageSize;        // Width and height of texture pages with ImFontAtlasFlags_MultiPage. Must be a power of two. Default to 1024.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
 
     // Output
@@ -3735,7 +3863,7 @@ struct ImFontAtlas
     ImTextureData*              TexData;            // Latest texture.
 
     // [Internal]
-    ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1). TexData is always == TexList.back(). DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
+    ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1). TexData is always == TexList.back(), unless using ImFontAtlasFlags_MultiPage. DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
     bool                        Locked;             // Marked as locked during ImGui::NewFrame()..EndFrame() scope if TexUpdates are not supported. Any attempt to modify the atlas will assert.
     bool                        RendererHasTextures;// Copy of (BackendFlags & ImGuiBackendFlags_RendererHasTextures) from supporting context.
     bool                        TexIsBuilt;         // Set when texture was built matching current font input. Mostly useful for legacy IsBuilt() call.
@@ -3745,6 +3873,7 @@ struct ImFontAtlas
     ImVector<ImFont*>           Fonts;              // Hold all the fonts returned by AddFont*. Fonts[0] is the default font upon calling ImGui::NewFrame(), use ImGui::PushFont()/PopFont() to change the current font.
     ImVector<ImFontConfig>      Sources;            // Source/configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVec4                      TexUvCorners[IM_DRAWLIST_TEX_CORNERS_RADIUS_MAX + 1]; // UVs for baked anti-aliased rounded corners: (x,y) at outer corner, (z,w) at circle center
     int                         TexNextUniqueID;    // Next value to be stored in TexData->UniqueID
     int                         FontNextUniqueID;   // Next value to be stored in ImFont->FontID
     ImVector<ImDrawListSharedData*> DrawListSharedDatas; // List of users for this atlas. Typically one per Dear ImGui context.
@@ -3963,6 +4092,24 @@ struct ImGuiPlatformIO
     // [Experimental] Configure decimal point e.g. '.' or ',' useful for some languages (e.g. German), generally pulled from *localeconv()->decimal_point
     ImWchar     Platform_LocaleDecimalPoint;     // '.'
 
+    // Optional: Monotonic high-resolution clock, in nanoseconds. Used by debug tools (e.g. Metrics->Profiler).
+    // (default to use QueryPerformanceCounter() on Windows, clock_gettime() on POSIX systems)
+    ImU64       (*Platform_GetTimeNsFn)(ImGuiContext* ctx);
+
+    // Optional: Run a loop on your job system. Used to process large ImDrawData over multiple threads (e.g. DeIndexAllBuffers(), ScaleClipRects(), CopyAllBuffers()).
+    // (default to NULL: run serially. Must call func(func_data, n) once for each n in [0, count), from any thread in any order, and only return when all calls are completed)
+    // (called from the thread calling the ImDrawData function. 'func' never calls back into Dear ImGui nor allocates memory, so it is safe to run with any thread)
+    void        (*Platform_ParallelForFn)(ImGuiContext* ctx, int count, void (*func)(void* func_data, int index), void* func_data);
+    void*       Platform_ParallelForUserData;
+
+    // Optional: Start a job on your job system and return immediately. Used to rasterize glyphs when ImFontAtlasFlags_AsyncGlyphLoad is set.
+    // (default to NULL: glyphs are rasterized synchronously. Return a handle for Platform_AsyncJobWaitFn(), or NULL if the job couldn't be started, in which case it runs on the calling thread)
+    // (Platform_AsyncJobWaitFn() returns true once 'func' has completed, blocking until then when 'blocking' is set. The handle is not used after returning true)
+    // ('func' never calls back into Dear ImGui. It allocates memory with the functions set by SetAllocatorFunctions() when the job was started: they need to be thread-safe, which the default ones are)
+    void*       (*Platform_AsyncJobStartFn)(ImGuiContext* ctx, void (*func)(void* func_data), void* func_data);
+    bool        (*Platform_AsyncJobWaitFn)(ImGuiContext* ctx, void* job_handle, bool blocking);
+    void*       Platform_AsyncJobUserData;
+
     //------------------------------------------------------------------
     // Input - Interface with Renderer Backend
     //------------------------------------------------------------------
@@ -3971,6 +4118,12 @@ struct ImGuiPlatformIO
     int         Renderer_TextureMaxWidth;
     int         Renderer_TextureMaxHeight;
 
+    // Optional: Provide contiguous buffers (typically mapped GPU buffers) for Render() to write all vertices/indices of a ImDrawData into, saving a copy in your RenderDrawData() function.
+    // Called by Render() once per ImDrawData with TotalVtxCount/TotalIdxCount/IdxSize known. Return false to keep the regular per-list buffers for this frame.
+    // When it returns true, Render() calls draw_data->ExportToArena(): each ImDrawCmd::VtxOffset/IdxOffset is then relative to start of your buffers (requires ImGuiBackendFlags_RendererHasVtxOffset).
+    bool        (*Renderer_GetDrawDataArenaFn)(ImGuiContext* ctx, ImDrawData* draw_data, ImDrawVert** out_vtx_dst, void** out_idx_dst);
+    void*       Renderer_DrawDataArenaUserData;
+
     // Written by some backends during ImGui_ImplXXXX_RenderDrawData() call to point backend_specific ImGui_ImplXXXX_RenderState* structure.
     void*       Renderer_RenderState;
 
@@ -10,7 +10,9 @@ Index of this file:
 // [SECTION] ImDrawList
 // [SECTION] ImTriangulator, ImDrawList concave polygon fill
 // [SECTION] ImDrawListSplitter
+// [SECTION] ImDrawListFragment
 // [SECTION] ImDrawData
+// [SECTION] ImDrawDataTileTracker
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontConfig
 // [SECTION] ImFontAtlas, ImFontAtlasBuilder
@@ -137,8 +139,22 @@ namespace IMGUI_STB_NAMESPACE
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+// Allocations use 'userdata' when set, which happens when rasterizing from a worker thread (ImFontAtlasFlags_AsyncGlyphLoad).
+static void* ImStbTrueTypeMalloc(size_t size, void* user_data)
+{
+    ImFontAtlasAsyncAllocator* allocator = (ImFontAtlasAsyncAllocator*)user_data;
+    return allocator ? allocator->AllocFunc(size, allocator->UserData) : IM_ALLOC(size);
+}
+static void ImStbTrueTypeFree(void* ptr, void* user_data)
+{
+    ImFontAtlasAsyncAllocator* allocator = (ImFontAtlasAsyncAllocator*)user_data;
+    if (allocator)
+        allocator->FreeFunc(ptr, allocator->UserData);
+    else
+        IM_FREE(ptr);
+}
+#define STBTT_malloc(x,u)   ImStbTrueTypeMalloc(x,u)
+#define STBTT_free(x,u)     ImStbTrueTypeFree(x,u)
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -419,6 +435,40 @@ void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
 }
 
+// Entries are compared bitwise, so a curve only hits if it is the same shape with the same tessellation settings.
+// Recycled entries keep their Points[] capacity: steady-state frames don't allocate.
+ImDrawListCurveCacheEntry* ImDrawListSharedData::CurveCacheGet(const float key[8])
+{
+    IM_STATIC_ASSERT(IM_DRAWLIST_CURVE_CACHE_SIZE % IM_DRAWLIST_CURVE_CACHE_WAYS == 0);
+    ImU32 hash = 0; // Multiply-rotate mixing: ImHashData() would cost as much as tessellating a small curve
+    for (int n = 0; n < 8; n++)
+    {
+        ImU32 k;
+        memcpy(&k, &key[n], sizeof(k));
+        hash = (hash ^ k) * 0x9E3779B1;
+        hash = (hash << 15) | (hash >> 17);
+    }
+    ImDrawListCurveCacheEntry* set = &CurveCache[(hash % (IM_DRAWLIST_CURVE_CACHE_SIZE / IM_DRAWLIST_CURVE_CACHE_WAYS)) * IM_DRAWLIST_CURVE_CACHE_WAYS];
+    ImDrawListCurveCacheEntry* lru = set;
+    const ImU32 tick = ++CurveCacheTick;
+    for (int n = 0; n < IM_DRAWLIST_CURVE_CACHE_WAYS; n++)
+    {
+        ImDrawListCurveCacheEntry* entry = &set[n];
+        if (entry->Hash == hash && entry->Points.Size > 0 && memcmp(entry->Key, key, sizeof(entry->Key)) == 0)
+        {
+            entry->LastUse = tick;
+            return entry;
+        }
+        if (entry->LastUse < lru->LastUse)
+            lru = entry;
+    }
+    lru->Hash = hash;
+    lru->LastUse = tick;
+    memcpy(lru->Key, key, sizeof(lru->Key));
+    lru->Points.resize(0);
+    return lru;
+}
+
 ImDrawList::ImDrawList(ImDrawListSharedData* shared_data)
 {
     memset(this, 0, sizeof(*this));
@@ -448,7 +498,7 @@ void ImDrawList::_ResetForNewFrame()
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, ClipRect) == 0);
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, TexRef) == sizeof(ImVec4));
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, VtxOffset) == sizeof(ImVec4) + sizeof(ImTextureRef));
-    if (_Splitter._Count > 1)
+    while (_Splitter._Count > 1 || _Splitter._Parents.Size > 0)
         _Splitter.Merge(this);
 
     CmdBuffer.resize(0);
@@ -466,6 +516,7 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = _Data->InitialFringeScale;
+    _ArenaVtxOffset = _ArenaIdxOffset = 0;
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -492,9 +543,73 @@ ImDrawList* ImDrawList::CloneOutput() const
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
     dst->Flags = Flags;
+    dst->_ArenaVtxOffset = _ArenaVtxOffset;
+    dst->_ArenaIdxOffset = _ArenaIdxOffset;
     return dst;
 }
 
+// Hash large buffers: this is a variant of xxHash32 (4 independent lanes of 32-bit words), several times faster than ImHashData() on big inputs.
+// Results depend on endianness, which is fine for comparing data within a process.
+static inline ImU32 ImDrawListHashRotl(ImU32 v, int r)     { return (v << r) | (v >> (32 - r)); }
+static inline ImU32 ImDrawListHashRead32(const unsigned char* p) { ImU32 v; memcpy(&v, p, 4); return v; }
+static ImU32 ImDrawListHashData(const void* data, size_t data_size, ImU32 seed)
+{
+    const ImU32 PRIME1 = 0x9E3779B1u, PRIME2 = 0x85EBCA77u, PRIME3 = 0xC2B2AE3Du, PRIME4 = 0x27D4EB2Fu, PRIME5 = 0x165667B1u;
+    const unsigned char* p = (const unsigned char*)data;
+    const unsigned char* p_end = p + data_size;
+    ImU32 h;
+    if (data_size >= 16)
+    {
+        ImU32 v1 = seed + PRIME1 + PRIME2, v2 = seed + PRIME2, v3 = seed, v4 = seed - PRIME1;
+        for (; p + 16 <= p_end; p += 16)
+        {
+            v1 = ImDrawListHashRotl(v1 + ImDrawListHashRead32(p + 0) * PRIME2, 13) * PRIME1;
+            v2 = ImDrawListHashRotl(v2 + ImDrawListHashRead32(p + 4) * PRIME2, 13) * PRIME1;
+            v3 = ImDrawListHashRotl(v3 + ImDrawListHashRead32(p + 8) * PRIME2, 13) * PRIME1;
+            v4 = ImDrawListHashRotl(v4 + ImDrawListHashRead32(p + 12) * PRIME2, 13) * PRIME1;
+        }
+        h = ImDrawListHashRotl(v1, 1) + ImDrawListHashRotl(v2, 7) + ImDrawListHashRotl(v3, 12) + ImDrawListHashRotl(v4, 18);
+    }
+    else
+    {
+        h = seed + PRIME5;
+    }
+    h += (ImU32)data_size;
+    for (; p + 4 <= p_end; p += 4)
+        h = ImDrawListHashRotl(h + ImDrawListHashRead32(p) * PRIME3, 17) * PRIME4;
+    for (; p < p_end; p++)
+        h = ImDrawListHashRotl(h + (*p) * PRIME5, 11) * PRIME1;
+    h ^= h >> 15; h *= PRIME2;
+    h ^= h >> 13; h *= PRIME3;
+    h ^= h >> 16;
+    return h;
+}
+
+// Hash output of the draw list, e.g. to detect that it didn't change since last frame.
+// Commands are hashed field by field (ImDrawCmd has padding), with offsets made relative to this list again if ImDrawData::ExportToArena() rebased them.
+// Callbacks are hashed by pointer, not by what they draw.
+ImU32 ImDrawList::CalcContentHash() const
+{
+    const size_t idx_size = (Flags & ImDrawListFlags_IdxPacked16) ? 2 : sizeof(ImDrawIdx);
+    ImU32 hash = ImDrawListHashData(VtxBuffer.Data, (size_t)VtxBuffer.Size * sizeof(ImDrawVert), 0);
+    hash = ImDrawListHashData(IdxBuffer.Data, (size_t)IdxBuffer.Size * idx_size, hash);
+    for (const ImDrawCmd& cmd : CmdBuffer)
+    {
+        struct { ImVec4 ClipRect; ImTextureData* TexData; ImTextureID TexID; ImDrawCallback UserCallback; void* UserCallbackData; unsigned int VtxOffset, IdxOffset, ElemCount; } key;
+        memset(&key, 0, sizeof(key));
+        key.ClipRect = cmd.ClipRect;
+        key.TexData = cmd.TexRef._TexData;
+        key.TexID = cmd.TexRef._TexID;
+        key.UserCallback = cmd.UserCallback;
+        key.UserCallbackData = cmd.UserCallbackData;
+        key.VtxOffset = cmd.VtxOffset - _ArenaVtxOffset;
+        key.IdxOffset = cmd.IdxOffset - _ArenaIdxOffset;
+        key.ElemCount = cmd.ElemCount;
+        hash = ImDrawListHashData(&key, sizeof(key), hash);
+    }
+    return hash;
+}
+
 void ImDrawList::AddDrawCmd()
 {
     ImDrawCmd draw_cmd;
@@ -798,6 +913,90 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// SSE2 versions of the above, operating on two ImVec2 at once (x0, y0, x1, y1).
+// They perform the exact same operations in the same order as the scalar macros, so output is bit-for-bit identical.
+// (ImRsqrt() uses _mm_rsqrt_ss() when IMGUI_ENABLE_SSE is defined, which matches _mm_rsqrt_ps())
+#ifdef IMGUI_ENABLE_SSE2
+static inline __m128 ImNormalize2x2fOverZero_SSE(__m128 v)
+{
+    __m128 sq = _mm_mul_ps(v, v);
+    __m128 d2 = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+    __m128 mask = _mm_cmpgt_ps(d2, _mm_setzero_ps());
+    __m128 v_norm = _mm_mul_ps(v, _mm_rsqrt_ps(d2));
+    return _mm_or_ps(_mm_and_ps(mask, v_norm), _mm_andnot_ps(mask, v));
+}
+
+static inline __m128 ImFixNormal2x2f_SSE(__m128 v)
+{
+    __m128 sq = _mm_mul_ps(v, v);
+    __m128 d2 = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+    __m128 mask = _mm_cmpgt_ps(d2, _mm_set1_ps(0.000001f));
+    __m128 inv_len2 = _mm_min_ps(_mm_div_ps(_mm_set1_ps(1.0f), d2), _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2));
+    __m128 v_fixed = _mm_mul_ps(v, inv_len2);
+    return _mm_or_ps(_mm_and_ps(mask, v_fixed), _mm_andnot_ps(mask, v));
+}
+
+// Write 'pattern_count' indices = pattern[] + base. Truncation to 16-bit matches the (ImDrawIdx) casts of the scalar code.
+static inline void ImWriteIndicesWithOffset_SSE(ImDrawIdx* dst, const ImDrawIdx* pattern, int pattern_count, unsigned int base)
+{
+    IM_STATIC_ASSERT(sizeof(ImDrawIdx) == 2 || sizeof(ImDrawIdx) == 4);
+    const int lanes = 16 / (int)sizeof(ImDrawIdx);
+    const __m128i base_v = (sizeof(ImDrawIdx) == 2) ? _mm_set1_epi16((short)base) : _mm_set1_epi32((int)base);
+    for (int n = 0; n < pattern_count; n += lanes)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(const void*)(pattern + n));
+        v = (sizeof(ImDrawIdx) == 2) ? _mm_add_epi16(v, base_v) : _mm_add_epi32(v, base_v);
+        _mm_storeu_si128((__m128i*)(void*)(dst + n), v);
+    }
+}
+
+// Indices for 4 consecutive segments (not wrapping around), relative to the first vertex of the first segment.
+// Must match the per-segment indices written by the scalar loops in AddPolyline().
+static const ImDrawIdx PolylineIdx4Tex[4 * 6] =
+{
+    2, 0, 1, 3, 1, 2,
+    4, 2, 3, 5, 3, 4,
+    6, 4, 5, 7, 5, 6,
+    8, 6, 7, 9, 7, 8,
+};
+static const ImDrawIdx PolylineIdx4Thin[4 * 12] =
+{
+    3, 0, 2, 2, 5, 3, 4, 1, 0, 0, 3, 4,
+    6, 3, 5, 5, 8, 6, 7, 4, 3, 3, 6, 7,
+    9, 6, 8, 8, 11, 9, 10, 7, 6, 6, 9, 10,
+    12, 9, 11, 11, 14, 12, 13, 10, 9, 9, 12, 13,
+};
+static const ImDrawIdx PolylineIdx4Thick[4 * 18] =
+{
+    5, 1, 2, 2, 6, 5, 5, 1, 0, 0, 4, 5, 6, 2, 3, 3, 7, 6,
+    9, 5, 6, 6, 10, 9, 9, 5, 4, 4, 8, 9, 10, 6, 7, 7, 11, 10,
+    13, 9, 10, 10, 14, 13, 13, 9, 8, 8, 12, 13, 14, 10, 11, 11, 15, 14,
+    17, 13, 14, 14, 18, 17, 17, 13, 12, 12, 16, 17, 18, 14, 15, 15, 19, 18,
+};
+#endif // #ifdef IMGUI_ENABLE_SSE2
+
+// Texture-based lines can be used for any thickness in the [1.0f, IM_DRAWLIST_TEX_LINES_WIDTH_MAX] range.
+// Rows of the baked texture are stacked by width, so for fractional widths we interpolate UV between the two rows surrounding
+// 'thickness': each edge vertex is placed at 'thickness * 0.5f + 1' from the center and the row spans 'width + 2' texels,
+// so the mapping stays at one texel per pixel. Total coverage and center of the line are exact. As consecutive rows are
+// centered half a texel apart, one side of the line gets a slightly softer fringe than the other at mid-fractions.
+static inline ImVec4 ImDrawListCalcTexUvLines(const ImDrawListSharedData* data, float thickness)
+{
+    const int integer_thickness = (int)thickness;
+    const float fractional_thickness = thickness - integer_thickness;
+    ImVec4 tex_uvs = data->TexUvLines[integer_thickness];
+    if (fractional_thickness > 0.0f)
+    {
+        IM_ASSERT(integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX);
+        const ImVec4 tex_uvs_1 = data->TexUvLines[integer_thickness + 1];
+        tex_uvs.x = tex_uvs.x + (tex_uvs_1.x - tex_uvs.x) * fractional_thickness; // inlined ImLerp()
+        tex_uvs.y = tex_uvs.y + (tex_uvs_1.y - tex_uvs.y) * fractional_thickness;
+        tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
+        tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
+    }
+    return tex_uvs;
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -818,13 +1017,12 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
 
         // Thicknesses <1.0 should behave like thickness 1.0
         thickness = ImMax(thickness, 1.0f);
-        const int integer_thickness = (int)thickness;
-        const float fractional_thickness = thickness - integer_thickness;
 
         // Do we want to draw this line using a texture?
-        // - For now, only draw integer-width lines using textures to avoid issues with the way scaling occurs, could be improved.
+        // - Fractional widths interpolate between two baked rows, see ImDrawListCalcTexUvLines().
+        // - Wider lines would need wider rows to keep a one-pixel fringe: use IM_DRAWLIST_TEX_LINES_WIDTH_MAX to bake more.
         // - If AA_SIZE is not 1.0f we cannot use the texture path.
-        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (thickness <= (float)IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (AA_SIZE == 1.0f);
 
         // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
         IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->OwnerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
@@ -840,7 +1038,17 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         ImVec2* temp_points = temp_normals + points_count;
 
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
+        int i1 = 0;
+#ifdef IMGUI_ENABLE_SSE2
+        for (; i1 + 2 < points_count; i1 += 2) // Two segments at a time, not wrapping around
+        {
+            __m128 d = _mm_sub_ps(_mm_loadu_ps(&points[i1 + 1].x), _mm_loadu_ps(&points[i1].x));
+            d = ImNormalize2x2fOverZero_SSE(d);
+            d = _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)), _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f)); // (dy, -dx)
+            _mm_storeu_ps(&temp_normals[i1].x, d);
+        }
+#endif
+        for (; i1 < count; i1++)
         {
             const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
             float dx = points[i2].x - points[i1].x;
@@ -878,7 +1086,37 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            i1 = 0;
+#ifdef IMGUI_ENABLE_SSE2
+            const __m128 half_draw_size_v = _mm_set1_ps(half_draw_size);
+            for (; i1 + 4 < points_count; i1 += 4) // Four segments at a time, not wrapping around
+            {
+                for (int n = 0; n < 4; n += 2)
+                {
+                    const int i2 = i1 + n + 1;
+                    __m128 dm = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&temp_normals[i2 - 1].x), _mm_loadu_ps(&temp_normals[i2].x)), _mm_set1_ps(0.5f));
+                    dm = _mm_mul_ps(ImFixNormal2x2f_SSE(dm), half_draw_size_v);
+                    __m128 p = _mm_loadu_ps(&points[i2].x);
+                    __m128 out_l = _mm_add_ps(p, dm);
+                    __m128 out_r = _mm_sub_ps(p, dm);
+                    _mm_storeu_ps(&temp_points[i2 * 2 + 0].x, _mm_movelh_ps(out_l, out_r));
+                    _mm_storeu_ps(&temp_points[i2 * 2 + 2].x, _mm_movehl_ps(out_r, out_l));
+                }
+                if (use_texture)
+                {
+                    ImWriteIndicesWithOffset_SSE(_IdxWritePtr, PolylineIdx4Tex, IM_ARRAYSIZE(PolylineIdx4Tex), idx1);
+                    _IdxWritePtr += IM_ARRAYSIZE(PolylineIdx4Tex);
+                    idx1 += 2 * 4;
+                }
+                else
+                {
+                    ImWriteIndicesWithOffset_SSE(_IdxWritePtr, PolylineIdx4Thin, IM_ARRAYSIZE(PolylineIdx4Thin), idx1);
+                    _IdxWritePtr += IM_ARRAYSIZE(PolylineIdx4Thin);
+                    idx1 += 3 * 4;
+                }
+            }
+#endif
+            for (; i1 < count; i1++) // i1 is the first point of the line segment
             {
                 const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
@@ -921,15 +1159,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             if (use_texture)
             {
                 // If we're using textures we only need to emit the left/right edge vertices
-                ImVec4 tex_uvs = _Data->TexUvLines[integer_thickness];
-                /*if (fractional_thickness != 0.0f) // Currently always zero when use_texture==false!
-                {
-                    const ImVec4 tex_uvs_1 = _Data->TexUvLines[integer_thickness + 1];
-                    tex_uvs.x = tex_uvs.x + (tex_uvs_1.x - tex_uvs.x) * fractional_thickness; // inlined ImLerp()
-                    tex_uvs.y = tex_uvs.y + (tex_uvs_1.y - tex_uvs.y) * fractional_thickness;
-                    tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
-                    tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
-                }*/
+                const ImVec4 tex_uvs = ImDrawListCalcTexUvLines(_Data, thickness);
                 ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
                 ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
                 for (int i = 0; i < points_count; i++)
@@ -974,7 +1204,35 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            i1 = 0;
+#ifdef IMGUI_ENABLE_SSE2
+            const __m128 half_outer_thickness_v = _mm_set1_ps(half_inner_thickness + AA_SIZE);
+            const __m128 half_inner_thickness_v = _mm_set1_ps(half_inner_thickness);
+            for (; i1 + 4 < points_count; i1 += 4) // Four segments at a time, not wrapping around
+            {
+                for (int n = 0; n < 4; n += 2)
+                {
+                    const int i2 = i1 + n + 1;
+                    __m128 dm = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&temp_normals[i2 - 1].x), _mm_loadu_ps(&temp_normals[i2].x)), _mm_set1_ps(0.5f));
+                    dm = ImFixNormal2x2f_SSE(dm);
+                    __m128 dm_out = _mm_mul_ps(dm, half_outer_thickness_v);
+                    __m128 dm_in = _mm_mul_ps(dm, half_inner_thickness_v);
+                    __m128 p = _mm_loadu_ps(&points[i2].x);
+                    __m128 out_0 = _mm_add_ps(p, dm_out);
+                    __m128 out_1 = _mm_add_ps(p, dm_in);
+                    __m128 out_2 = _mm_sub_ps(p, dm_in);
+                    __m128 out_3 = _mm_sub_ps(p, dm_out);
+                    _mm_storeu_ps(&temp_points[i2 * 4 + 0].x, _mm_movelh_ps(out_0, out_1));
+                    _mm_storeu_ps(&temp_points[i2 * 4 + 2].x, _mm_movelh_ps(out_2, out_3));
+                    _mm_storeu_ps(&temp_points[i2 * 4 + 4].x, _mm_movehl_ps(out_1, out_0));
+                    _mm_storeu_ps(&temp_points[i2 * 4 + 6].x, _mm_movehl_ps(out_3, out_2));
+                }
+                ImWriteIndicesWithOffset_SSE(_IdxWritePtr, PolylineIdx4Thick, IM_ARRAYSIZE(PolylineIdx4Thick), idx1);
+                _IdxWritePtr += IM_ARRAYSIZE(PolylineIdx4Thick);
+                idx1 += 4 * 4;
+            }
+#endif
+            for (; i1 < count; i1++) // i1 is the first point of the line segment
             {
                 const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
@@ -1063,6 +1321,18 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
     if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
         return;
 
+    if (Flags & ImDrawListFlags_AntiAliasedFill)
+        PrimReserve((points_count - 2) * 3 + points_count * 6, points_count * 2);
+    else
+        PrimReserve((points_count - 2) * 3, points_count);
+    _PrimConvexPolyFilled(points, points_count, col);
+}
+
+// Write a filled convex polygon into space previously reserved with PrimReserve().
+// Requires (points_count - 2) * 3 + points_count * 6 indices and points_count * 2 vertices with ImDrawListFlags_AntiAliasedFill,
+// (points_count - 2) * 3 indices and points_count vertices otherwise.
+void ImDrawList::_PrimConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+{
     const ImVec2 uv = _Data->TexUvWhitePixel;
 
     if (Flags & ImDrawListFlags_AntiAliasedFill)
@@ -1070,9 +1340,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         // Anti-aliased Fill
         const float AA_SIZE = _FringeScale;
         const ImU32 col_trans = col & ~IM_COL32_A_MASK;
-        const int idx_count = (points_count - 2)*3 + points_count * 6;
         const int vtx_count = (points_count * 2);
-        PrimReserve(idx_count, vtx_count);
 
         // Add indexes for fill
         unsigned int vtx_inner_idx = _VtxCurrentIdx;
@@ -1123,9 +1391,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
     else
     {
         // Non Anti-aliased Fill
-        const int idx_count = (points_count - 2)*3;
         const int vtx_count = points_count;
-        PrimReserve(idx_count, vtx_count);
         for (int i = 0; i < vtx_count; i++)
         {
             _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
@@ -1242,12 +1508,29 @@ void ImDrawList::_PathArcToN(const ImVec2& center, float radius, float a_min, fl
 
     // Note that we are adding a point at both a_min and a_max.
     // If you are trying to draw a full closed circle you don't want the overlapping points!
-    _Path.reserve(_Path.Size + (num_segments + 1));
-    for (int i = 0; i <= num_segments; i++)
+    // Points relative to center are cached, saving the sin/cos calls when the same arc is drawn again.
+    const float key[8] = { 2.0f, radius, a_min, a_max, (float)num_segments, 0.0f, 0.0f, 0.0f };
+    ImDrawListCurveCacheEntry* entry = _Data->CurveCacheGet(key);
+    if (entry->Points.Size == 0)
     {
-        const float a = a_min + ((float)i / (float)num_segments) * (a_max - a_min);
-        _Path.push_back(ImVec2(center.x + ImCos(a) * radius, center.y + ImSin(a) * radius));
+        entry->Points.reserve(num_segments + 1);
+        for (int i = 0; i <= num_segments; i++)
+        {
+            const float a = a_min + ((float)i / (float)num_segments) * (a_max - a_min);
+            entry->Points.push_back(ImVec2(ImCos(a) * radius, ImSin(a) * radius));
+        }
     }
+    _PathAddCachedPoints(center, entry->Points);
+}
+
+// Append points stored relative to 'origin'
+void ImDrawList::_PathAddCachedPoints(const ImVec2& origin, const ImVector<ImVec2>& points)
+{
+    _Path.reserve(_Path.Size + points.Size);
+    ImVec2* out = _Path.Data + _Path.Size;
+    for (const ImVec2& p : points)
+        *out++ = ImVec2(origin.x + p.x, origin.y + p.y);
+    _Path.Size += points.Size;
 }
 
 // 0: East, 3: South, 6: West, 9: North, 12: East
@@ -1399,8 +1682,14 @@ void ImDrawList::PathBezierCubicCurveTo(const ImVec2& p2, const ImVec2& p3, cons
     ImVec2 p1 = _Path.back();
     if (num_segments == 0)
     {
-        IM_ASSERT(_Data->CurveTessellationTol > 0.0f);
-        PathBezierCubicCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, p4.x, p4.y, _Data->CurveTessellationTol, 0); // Auto-tessellated
+        // Auto-tessellated. Tessellate relative to p1 so the result can be reused wherever the same curve is drawn.
+        const float tess_tol = _Data->CurveTessellationTol;
+        IM_ASSERT(tess_tol > 0.0f);
+        const float key[8] = { 1.0f, p2.x - p1.x, p2.y - p1.y, p3.x - p1.x, p3.y - p1.y, p4.x - p1.x, p4.y - p1.y, tess_tol };
+        ImDrawListCurveCacheEntry* entry = _Data->CurveCacheGet(key);
+        if (entry->Points.Size == 0)
+            PathBezierCubicCurveToCasteljau(&entry->Points, 0.0f, 0.0f, key[1], key[2], key[3], key[4], key[5], key[6], tess_tol, 0);
+        _PathAddCachedPoints(p1, entry->Points);
     }
     else
     {
@@ -1450,13 +1739,20 @@ static inline ImDrawFlags FixRectCornerFlags(ImDrawFlags flags)
     return flags;
 }
 
+// Shrink rounding so that arcs fit within the rectangle. 'flags' needs to go through FixRectCornerFlags().
+static inline float ClampRectRounding(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
+{
+    rounding = ImMin(rounding, ImFabs(b.x - a.x) * (((flags & ImDrawFlags_RoundCornersTop) == ImDrawFlags_RoundCornersTop) || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f) - 1.0f);
+    rounding = ImMin(rounding, ImFabs(b.y - a.y) * (((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight) == ImDrawFlags_RoundCornersRight) ? 0.5f : 1.0f) - 1.0f);
+    return rounding;
+}
+
 void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
 {
     if (rounding >= 0.5f)
     {
         flags = FixRectCornerFlags(flags);
-        rounding = ImMin(rounding, ImFabs(b.x - a.x) * (((flags & ImDrawFlags_RoundCornersTop) == ImDrawFlags_RoundCornersTop) || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f) - 1.0f);
-        rounding = ImMin(rounding, ImFabs(b.y - a.y) * (((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight) == ImDrawFlags_RoundCornersRight) ? 0.5f : 1.0f) - 1.0f);
+        rounding = ClampRectRounding(a, b, rounding, flags);
     }
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
@@ -1500,6 +1796,53 @@ void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, fl
     PathStroke(col, ImDrawFlags_Closed, thickness);
 }
 
+// Filled rounded rectangle using baked anti-aliased corners (see ImFontAtlasBuildUpdateCornersTexData()).
+// One textured quad per rounded corner + up to 3 solid quads: at most 28 vertices and 42 indices regardless of rounding.
+// Return false if rounding is outside of the range of baked radii, in which case nothing is drawn.
+// Batch functions pass 'reserve = false' after reserving room for the maximum count of vertices/indices themselves.
+#define IM_DRAWLIST_TEX_RECT_MAX_VTX    28
+#define IM_DRAWLIST_TEX_RECT_MAX_IDX    42
+static bool AddRectFilledRoundedUsingTex(ImDrawList* draw_list, const ImVec2& a, const ImVec2& b, ImU32 col, float rounding, ImDrawFlags flags, bool reserve = true)
+{
+    flags = FixRectCornerFlags(flags);
+    rounding = ClampRectRounding(a, b, rounding, flags);
+    const int tex_radius = (int)(rounding + 0.5f); // Use nearest baked radius, stretched to 'rounding'.
+    if (tex_radius < 1 || tex_radius > IM_DRAWLIST_TEX_CORNERS_RADIUS_MAX)
+        return false;
+    const ImVec4 uvs = draw_list->_Data->TexUvCorners[tex_radius];
+
+    const float rounding_t = (flags & ImDrawFlags_RoundCornersTop) ? rounding : 0.0f;
+    const float rounding_b = (flags & ImDrawFlags_RoundCornersBottom) ? rounding : 0.0f;
+    const float rounding_tl = (flags & ImDrawFlags_RoundCornersTopLeft) ? rounding : 0.0f;
+    const float rounding_tr = (flags & ImDrawFlags_RoundCornersTopRight) ? rounding : 0.0f;
+    const float rounding_bl = (flags & ImDrawFlags_RoundCornersBottomLeft) ? rounding : 0.0f;
+    const float rounding_br = (flags & ImDrawFlags_RoundCornersBottomRight) ? rounding : 0.0f;
+    if (rounding_t + rounding_b > b.y - a.y)
+        return false; // Opposite corners rounded with a rounding larger than half the height: top and bottom rows would overlap.
+    const int corners_count = (rounding_tl > 0.0f) + (rounding_tr > 0.0f) + (rounding_bl > 0.0f) + (rounding_br > 0.0f);
+    const int quads_count = 1 + (rounding_t > 0.0f) + (rounding_b > 0.0f) + corners_count;
+    if (reserve)
+        draw_list->PrimReserve(quads_count * 6, quads_count * 4);
+
+    // Top row, middle row (full width), bottom row
+    if (rounding_t > 0.0f)
+        draw_list->PrimRect(ImVec2(a.x + rounding_tl, a.y), ImVec2(b.x - rounding_tr, a.y + rounding_t), col);
+    draw_list->PrimRect(ImVec2(a.x, a.y + rounding_t), ImVec2(b.x, b.y - rounding_b), col);
+    if (rounding_b > 0.0f)
+        draw_list->PrimRect(ImVec2(a.x + rounding_bl, b.y - rounding_b), ImVec2(b.x - rounding_br, b.y), col);
+
+    // Corners, mirroring the same quarter disc
+    if (rounding_tl > 0.0f)
+        draw_list->PrimRectUV(ImVec2(a.x, a.y), ImVec2(a.x + rounding, a.y + rounding), ImVec2(uvs.x, uvs.y), ImVec2(uvs.z, uvs.w), col);
+    if (rounding_tr > 0.0f)
+        draw_list->PrimRectUV(ImVec2(b.x - rounding, a.y), ImVec2(b.x, a.y + rounding), ImVec2(uvs.z, uvs.y), ImVec2(uvs.x, uvs.w), col);
+    if (rounding_bl > 0.0f)
+        draw_list->PrimRectUV(ImVec2(a.x, b.y - rounding), ImVec2(a.x + rounding, b.y), ImVec2(uvs.x, uvs.w), ImVec2(uvs.z, uvs.y), col);
+    if (rounding_br > 0.0f)
+        draw_list->PrimRectUV(ImVec2(b.x - rounding, b.y - rounding), ImVec2(b.x, b.y), ImVec2(uvs.z, uvs.w), ImVec2(uvs.x, uvs.y), col);
+    return true;
+}
+
 void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding, ImDrawFlags flags)
 {
     if ((col & IM_COL32_A_MASK) == 0)
@@ -1509,6 +1852,10 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
         PrimReserve(6, 4);
         PrimRect(p_min, p_max, col);
     }
+    else if ((Flags & ImDrawListFlags_AntiAliasedFillUseTex) && _FringeScale == 1.0f && AddRectFilledRoundedUsingTex(this, p_min, p_max, col, rounding, flags))
+    {
+        return;
+    }
     else
     {
         PathRect(p_min, p_max, rounding, flags);
@@ -1602,11 +1949,42 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
     PathStroke(col, ImDrawFlags_Closed, thickness);
 }
 
+// Filled circle using baked anti-aliased corners (see ImFontAtlasBuildUpdateCornersTexData()).
+// A 3x3 vertices grid mirroring the same quarter disc in each quadrant: 9 vertices and 24 indices regardless of radius.
+// Return false if radius is outside of the range of baked radii, in which case nothing is drawn.
+#define IM_DRAWLIST_TEX_CIRCLE_VTX      9
+#define IM_DRAWLIST_TEX_CIRCLE_IDX      24
+static bool AddCircleFilledUsingTex(ImDrawList* draw_list, const ImVec2& center, float radius, ImU32 col, bool reserve = true)
+{
+    const int tex_radius = (int)(radius + 0.5f); // Use nearest baked radius, stretched to 'radius'.
+    if (tex_radius < 1 || tex_radius > IM_DRAWLIST_TEX_CORNERS_RADIUS_MAX)
+        return false;
+    const ImVec4 uvs = draw_list->_Data->TexUvCorners[tex_radius];
+
+    if (reserve)
+        draw_list->PrimReserve(IM_DRAWLIST_TEX_CIRCLE_IDX, IM_DRAWLIST_TEX_CIRCLE_VTX);
+    const ImDrawIdx idx = (ImDrawIdx)draw_list->_VtxCurrentIdx;
+    for (int cell_y = 0; cell_y < 2; cell_y++)
+        for (int cell_x = 0; cell_x < 2; cell_x++)
+        {
+            const ImDrawIdx cell_idx = (ImDrawIdx)(idx + cell_y * 3 + cell_x);
+            draw_list->PrimWriteIdx(cell_idx); draw_list->PrimWriteIdx((ImDrawIdx)(cell_idx + 1)); draw_list->PrimWriteIdx((ImDrawIdx)(cell_idx + 4));
+            draw_list->PrimWriteIdx(cell_idx); draw_list->PrimWriteIdx((ImDrawIdx)(cell_idx + 4)); draw_list->PrimWriteIdx((ImDrawIdx)(cell_idx + 3));
+        }
+    for (int y = -1; y <= +1; y++)
+        for (int x = -1; x <= +1; x++)
+            draw_list->PrimWriteVtx(ImVec2(center.x + x * radius, center.y + y * radius), ImVec2(x ? uvs.x : uvs.z, y ? uvs.y : uvs.w), col);
+    return true;
+}
+
 void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col, int num_segments)
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
 
+    if (num_segments <= 0 && (Flags & ImDrawListFlags_AntiAliasedFillUseTex) && _FringeScale == 1.0f && AddCircleFilledUsingTex(this, center, radius, col))
+        return;
+
     if (num_segments <= 0)
     {
         // Use arc with automatic segment count
@@ -1626,6 +2004,282 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
     PathFillConvex(col);
 }
 
+// Batched primitives
+// - Vertices and indices are reserved for a chunk of instances at a time using a per-instance upper bound,
+//   then the unused part is released with PrimUnreserve().
+// - Chunks are kept small: with 16-bit indices, PrimReserve() starts a new VtxOffset when a reservation doesn't fit
+//   in the current 64k vertices range, so over-reserving too much would create more draw commands than needed.
+// - Rounded rectangles and circles take the same path as AddRectFilled()/AddCircleFilled(): baked corners textures when
+//   ImDrawListFlags_AntiAliasedFillUseTex is set and the radius is in range, else an outline built in _Path.
+//   Instances are reserved for the largest of both.
+static inline int ImDrawListBatchMaxInstances(int vtx_per_instance)
+{
+    return ImMax(4096 / vtx_per_instance, 1);
+}
+
+void ImDrawList::AddRectFilledBatch(const ImVec2* p_min, const ImVec2* p_max, const ImU32* cols, int count, float rounding, ImDrawFlags flags)
+{
+    if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
+    {
+        // Axis aligned rectangles: same as PrimRect()
+        const ImVec2 uv = _Data->TexUvWhitePixel;
+        const int max_instances = ImDrawListBatchMaxInstances(4);
+        for (int n = 0; n < count; )
+        {
+            const int chunk_count = ImMin(count - n, max_instances);
+            PrimReserve(chunk_count * 6, chunk_count * 4);
+            int skipped = 0;
+            for (const int n_end = n + chunk_count; n < n_end; n++)
+            {
+                const ImU32 col = cols[n];
+                if ((col & IM_COL32_A_MASK) == 0)
+                {
+                    skipped++;
+                    continue;
+                }
+                const ImVec2 a = p_min[n];
+                const ImVec2 c = p_max[n];
+                const ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
+                _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx + 1); _IdxWritePtr[2] = (ImDrawIdx)(idx + 2);
+                _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx + 2); _IdxWritePtr[5] = (ImDrawIdx)(idx + 3);
+                _VtxWritePtr[0].pos = a;                _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+                _VtxWritePtr[1].pos = ImVec2(c.x, a.y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr[2].pos = c;                _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
+                _VtxWritePtr[3].pos = ImVec2(a.x, c.y); _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
+                _VtxWritePtr += 4;
+                _VtxCurrentIdx += 4;
+                _IdxWritePtr += 6;
+            }
+            if (skipped > 0)
+                PrimUnreserve(skipped * 6, skipped * 4);
+        }
+        return;
+    }
+
+    // Rounded rectangles: PathRect() emits at most 4 quarter arcs
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    const bool use_tex = (Flags & ImDrawListFlags_AntiAliasedFillUseTex) && _FringeScale == 1.0f;
+    const int max_points = 4 * (IM_DRAWLIST_ARCFAST_SAMPLE_MAX / 4 + 1);
+    const int max_vtx = ImMax(anti_aliased ? max_points * 2 : max_points, IM_DRAWLIST_TEX_RECT_MAX_VTX);
+    const int max_idx = ImMax(anti_aliased ? (max_points - 2) * 3 + max_points * 6 : (max_points - 2) * 3, IM_DRAWLIST_TEX_RECT_MAX_IDX);
+    const int max_instances = ImDrawListBatchMaxInstances(max_vtx);
+    for (int n = 0; n < count; )
+    {
+        const int chunk_count = ImMin(count - n, max_instances);
+        PrimReserve(chunk_count * max_idx, chunk_count * max_vtx);
+        ImDrawVert* vtx_reserved_end = _VtxWritePtr + chunk_count * max_vtx;
+        ImDrawIdx* idx_reserved_end = _IdxWritePtr + chunk_count * max_idx;
+        for (const int n_end = n + chunk_count; n < n_end; n++)
+        {
+            if ((cols[n] & IM_COL32_A_MASK) == 0)
+                continue;
+            if (use_tex && AddRectFilledRoundedUsingTex(this, p_min[n], p_max[n], cols[n], rounding, flags, false))
+                continue;
+            PathRect(p_min[n], p_max[n], rounding, flags);
+            IM_ASSERT(_Path.Size <= max_points);
+            if (_Path.Size >= 3)
+                _PrimConvexPolyFilled(_Path.Data, _Path.Size, cols[n]);
+            _Path.Size = 0;
+        }
+        PrimUnreserve((int)(idx_reserved_end - _IdxWritePtr), (int)(vtx_reserved_end - _VtxWritePtr));
+    }
+}
+
+// Same geometry as AddLine() -> AddPolyline() with 2 points and no ImDrawFlags_Closed, without the temporary buffers.
+// We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
+void ImDrawList::AddLineBatch(const ImVec2* p1, const ImVec2* p2, const ImU32* cols, int count, float thickness)
+{
+    const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
+    const bool thick_line = (thickness > _FringeScale);
+    if (Flags & ImDrawListFlags_AntiAliasedLines)
+    {
+        const float AA_SIZE = _FringeScale;
+        thickness = ImMax(thickness, 1.0f);
+        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (thickness <= (float)IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (AA_SIZE == 1.0f);
+        const int idx_per_line = use_texture ? 6 : (thick_line ? 18 : 12);
+        const int vtx_per_line = use_texture ? 4 : (thick_line ? 8 : 6);
+        const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE; // [PATH 1] and [PATH 2] (non-thick)
+        const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;                // [PATH 2] (thick)
+        const ImVec4 tex_uvs = use_texture ? ImDrawListCalcTexUvLines(_Data, thickness) : ImVec4();
+        const ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
+        const ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
+
+        const int max_instances = ImDrawListBatchMaxInstances(vtx_per_line);
+        for (int n = 0; n < count; )
+        {
+            const int chunk_count = ImMin(count - n, max_instances);
+            PrimReserve(chunk_count * idx_per_line, chunk_count * vtx_per_line);
+            int skipped = 0;
+            for (const int n_end = n + chunk_count; n < n_end; n++)
+            {
+                const ImU32 col = cols[n];
+                if ((col & IM_COL32_A_MASK) == 0)
+                {
+                    skipped++;
+                    continue;
+                }
+                const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+                const float a_x = p1[n].x + 0.5f, a_y = p1[n].y + 0.5f;
+                const float b_x = p2[n].x + 0.5f, b_y = p2[n].y + 0.5f;
+
+                // Normal of the segment, used as is at the first point
+                float dx = b_x - a_x;
+                float dy = b_y - a_y;
+                IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+                const float n_x = dy;
+                const float n_y = -dx;
+
+                // Averaged normal at the second point (averaging the same normal twice, which is what AddPolyline() does)
+                float dm_x = (n_x + n_x) * 0.5f;
+                float dm_y = (n_y + n_y) * 0.5f;
+                IM_FIXNORMAL2F(dm_x, dm_y);
+
+                const unsigned int idx1 = _VtxCurrentIdx;
+                if (use_texture || !thick_line)
+                {
+                    const float a_dx = n_x * half_draw_size, a_dy = n_y * half_draw_size;
+                    dm_x *= half_draw_size;
+                    dm_y *= half_draw_size;
+                    if (use_texture)
+                    {
+                        const unsigned int idx2 = idx1 + 2;
+                        _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 1); // Right tri
+                        _IdxWritePtr[3] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[4] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Left tri
+                        _VtxWritePtr[0].pos.x = a_x + a_dx; _VtxWritePtr[0].pos.y = a_y + a_dy; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col;
+                        _VtxWritePtr[1].pos.x = a_x - a_dx; _VtxWritePtr[1].pos.y = a_y - a_dy; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col;
+                        _VtxWritePtr[2].pos.x = b_x + dm_x; _VtxWritePtr[2].pos.y = b_y + dm_y; _VtxWritePtr[2].uv = tex_uv0; _VtxWritePtr[2].col = col;
+                        _VtxWritePtr[3].pos.x = b_x - dm_x; _VtxWritePtr[3].pos.y = b_y - dm_y; _VtxWritePtr[3].uv = tex_uv1; _VtxWritePtr[3].col = col;
+                    }
+                    else
+                    {
+                        const unsigned int idx2 = idx1 + 3;
+                        _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 2); // Right tri 1
+                        _IdxWritePtr[3] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Right tri 2
+                        _IdxWritePtr[6] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8] = (ImDrawIdx)(idx1 + 0); // Left tri 1
+                        _IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
+                        _VtxWritePtr[0].pos.x = a_x;        _VtxWritePtr[0].pos.y = a_y;        _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
+                        _VtxWritePtr[1].pos.x = a_x + a_dx; _VtxWritePtr[1].pos.y = a_y + a_dy; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans;
+                        _VtxWritePtr[2].pos.x = a_x - a_dx; _VtxWritePtr[2].pos.y = a_y - a_dy; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans;
+                        _VtxWritePtr[3].pos.x = b_x;        _VtxWritePtr[3].pos.y = b_y;        _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+                        _VtxWritePtr[4].pos.x = b_x + dm_x; _VtxWritePtr[4].pos.y = b_y + dm_y; _VtxWritePtr[4].uv = opaque_uv; _VtxWritePtr[4].col = col_trans;
+                        _VtxWritePtr[5].pos.x = b_x - dm_x; _VtxWritePtr[5].pos.y = b_y - dm_y; _VtxWritePtr[5].uv = opaque_uv; _VtxWritePtr[5].col = col_trans;
+                    }
+                }
+                else
+                {
+                    const float a_out_x = n_x * (half_inner_thickness + AA_SIZE), a_out_y = n_y * (half_inner_thickness + AA_SIZE);
+                    const float a_in_x = n_x * half_inner_thickness, a_in_y = n_y * half_inner_thickness;
+                    const float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE), dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
+                    const float dm_in_x = dm_x * half_inner_thickness, dm_in_y = dm_y * half_inner_thickness;
+                    const unsigned int idx2 = idx1 + 4;
+                    _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
+                    _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
+                    _IdxWritePtr[6]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1 + 0);
+                    _IdxWritePtr[9]  = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1);
+                    _IdxWritePtr[12] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[13] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[14] = (ImDrawIdx)(idx1 + 3);
+                    _IdxWritePtr[15] = (ImDrawIdx)(idx1 + 3); _IdxWritePtr[16] = (ImDrawIdx)(idx2 + 3); _IdxWritePtr[17] = (ImDrawIdx)(idx2 + 2);
+                    _VtxWritePtr[0].pos.x = a_x + a_out_x;  _VtxWritePtr[0].pos.y = a_y + a_out_y;  _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
+                    _VtxWritePtr[1].pos.x = a_x + a_in_x;   _VtxWritePtr[1].pos.y = a_y + a_in_y;   _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+                    _VtxWritePtr[2].pos.x = a_x - a_in_x;   _VtxWritePtr[2].pos.y = a_y - a_in_y;   _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+                    _VtxWritePtr[3].pos.x = a_x - a_out_x;  _VtxWritePtr[3].pos.y = a_y - a_out_y;  _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
+                    _VtxWritePtr[4].pos.x = b_x + dm_out_x; _VtxWritePtr[4].pos.y = b_y + dm_out_y; _VtxWritePtr[4].uv = opaque_uv; _VtxWritePtr[4].col = col_trans;
+                    _VtxWritePtr[5].pos.x = b_x + dm_in_x;  _VtxWritePtr[5].pos.y = b_y + dm_in_y;  _VtxWritePtr[5].uv = opaque_uv; _VtxWritePtr[5].col = col;
+                    _VtxWritePtr[6].pos.x = b_x - dm_in_x;  _VtxWritePtr[6].pos.y = b_y - dm_in_y;  _VtxWritePtr[6].uv = opaque_uv; _VtxWritePtr[6].col = col;
+                    _VtxWritePtr[7].pos.x = b_x - dm_out_x; _VtxWritePtr[7].pos.y = b_y - dm_out_y; _VtxWritePtr[7].uv = opaque_uv; _VtxWritePtr[7].col = col_trans;
+                }
+                _VtxWritePtr += vtx_per_line;
+                _IdxWritePtr += idx_per_line;
+                _VtxCurrentIdx += vtx_per_line;
+            }
+            if (skipped > 0)
+                PrimUnreserve(skipped * idx_per_line, skipped * vtx_per_line);
+        }
+    }
+    else
+    {
+        // Non anti-aliased lines: same as [PATH 4] in AddPolyline()
+        const int max_instances = ImDrawListBatchMaxInstances(4);
+        for (int n = 0; n < count; )
+        {
+            const int chunk_count = ImMin(count - n, max_instances);
+            PrimReserve(chunk_count * 6, chunk_count * 4);
+            int skipped = 0;
+            for (const int n_end = n + chunk_count; n < n_end; n++)
+            {
+                const ImU32 col = cols[n];
+                if ((col & IM_COL32_A_MASK) == 0)
+                {
+                    skipped++;
+                    continue;
+                }
+                const float a_x = p1[n].x + 0.5f, a_y = p1[n].y + 0.5f;
+                const float b_x = p2[n].x + 0.5f, b_y = p2[n].y + 0.5f;
+                float dx = b_x - a_x;
+                float dy = b_y - a_y;
+                IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+                dx *= (thickness * 0.5f);
+                dy *= (thickness * 0.5f);
+
+                _VtxWritePtr[0].pos.x = a_x + dy; _VtxWritePtr[0].pos.y = a_y - dx; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
+                _VtxWritePtr[1].pos.x = b_x + dy; _VtxWritePtr[1].pos.y = b_y - dx; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr[2].pos.x = b_x - dy; _VtxWritePtr[2].pos.y = b_y + dx; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+                _VtxWritePtr[3].pos.x = a_x - dy; _VtxWritePtr[3].pos.y = a_y + dx; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+                _VtxWritePtr += 4;
+
+                _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
+                _IdxWritePtr[3] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[4] = (ImDrawIdx)(_VtxCurrentIdx + 2); _IdxWritePtr[5] = (ImDrawIdx)(_VtxCurrentIdx + 3);
+                _IdxWritePtr += 6;
+                _VtxCurrentIdx += 4;
+            }
+            if (skipped > 0)
+                PrimUnreserve(skipped * 6, skipped * 4);
+        }
+    }
+}
+
+void ImDrawList::AddCircleFilledBatch(const ImVec2* centers, const float* radii, const ImU32* cols, int count, int num_segments)
+{
+    // Because we are filling a closed shape we remove 1 from the count of segments/points (see AddCircleFilled())
+    if (num_segments > 0)
+        num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+    const float a_max = (num_segments > 0) ? (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments : 0.0f;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    const bool use_tex = num_segments <= 0 && (Flags & ImDrawListFlags_AntiAliasedFillUseTex) && _FringeScale == 1.0f;
+    const int max_points = (num_segments > 0) ? num_segments : IM_DRAWLIST_ARCFAST_SAMPLE_MAX;
+    const int max_vtx = ImMax(anti_aliased ? max_points * 2 : max_points, IM_DRAWLIST_TEX_CIRCLE_VTX);
+    const int max_idx = ImMax(anti_aliased ? (max_points - 2) * 3 + max_points * 6 : (max_points - 2) * 3, IM_DRAWLIST_TEX_CIRCLE_IDX);
+    const int max_instances = ImDrawListBatchMaxInstances(max_vtx);
+    for (int n = 0; n < count; )
+    {
+        const int chunk_count = ImMin(count - n, max_instances);
+        PrimReserve(chunk_count * max_idx, chunk_count * max_vtx);
+        ImDrawVert* vtx_reserved_end = _VtxWritePtr + chunk_count * max_vtx;
+        ImDrawIdx* idx_reserved_end = _IdxWritePtr + chunk_count * max_idx;
+        for (const int n_end = n + chunk_count; n < n_end; n++)
+        {
+            const float radius = radii[n];
+            if ((cols[n] & IM_COL32_A_MASK) == 0 || radius < 0.5f)
+                continue;
+            if (use_tex && AddCircleFilledUsingTex(this, centers[n], radius, cols[n], false))
+                continue;
+            if (num_segments <= 0)
+            {
+                _PathArcToFastEx(centers[n], radius, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, 0);
+                _Path.Size--;
+            }
+            else
+            {
+                PathArcTo(centers[n], radius, 0.0f, a_max, num_segments - 1);
+            }
+            IM_ASSERT(_Path.Size <= max_points);
+            if (_Path.Size >= 3)
+                _PrimConvexPolyFilled(_Path.Data, _Path.Size, cols[n]);
+            _Path.Size = 0;
+        }
+        PrimUnreserve((int)(idx_reserved_end - _IdxWritePtr), (int)(vtx_reserved_end - _VtxWritePtr));
+    }
+}
+
 // Guaranteed to honor 'num_segments'
 void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_segments, float thickness)
 {
@@ -1794,8 +2448,11 @@ void ImDrawList::AddImageRounded(ImTextureRef tex_ref, const ImVec2& p_min, cons
 //-----------------------------------------------------------------------------
 // [SECTION] ImTriangulator, ImDrawList concave polygon fill
 //-----------------------------------------------------------------------------
-// Triangulate concave polygons. Based on "Triangulation by Ear Clipping" paper, O(N^2) complexity.
-// Reference: https://www.geometrictools.com/Documentation/TriangulationByEarClipping.pdf
+// Triangulate concave polygons, optionally with holes. O(N log N) complexity.
+// - A sweep line going from top to bottom adds diagonals splitting the polygon into y-monotone pieces.
+//   Edges crossing the sweep line are stored in a binary search tree (treap), ordered by their X coordinate on the sweep line.
+// - Each piece is then triangulated in linear time.
+// Reference: "Computational Geometry: Algorithms and Applications" (de Berg et al.), chapter 3 "Polygon Triangulation".
 // Provided as a convenience for user but not used by main library.
 //-----------------------------------------------------------------------------
 // - ImTriangulator [Internal]
@@ -1804,237 +2461,593 @@ void ImDrawList::AddImageRounded(ImTextureRef tex_ref, const ImVec2& p_min, cons
 
 enum ImTriangulatorNodeType
 {
-    ImTriangulatorNodeType_Convex,
-    ImTriangulatorNodeType_Ear,
-    ImTriangulatorNodeType_Reflex
+    ImTriangulatorNodeType_Regular,
+    ImTriangulatorNodeType_Start,
+    ImTriangulatorNodeType_End,
+    ImTriangulatorNodeType_Split,
+    ImTriangulatorNodeType_Merge
 };
 
 struct ImTriangulatorNode
 {
+    ImVec2                  Pos;            // Position with Y axis pointing up, contours are oriented so the interior is on the left of each edge
+    int                     Next;           // Next node along the contour (-1 when the contour is ignored)
+    int                     Prev;
+    int                     Rank;           // Position in sweep order
+    int                     Helper;         // Helper of edge (this, Next) while it is crossing the sweep line
+    int                     DiagonalHead;   // First diagonal leaving this node, or -1
+    int                     StatusParent;   // Links of edge (this, Next) in sweep status tree
+    int                     StatusChild[2];
+    ImU32                   StatusPriority;
     ImTriangulatorNodeType  Type;
-    int                     Index;
-    ImVec2                  Pos;
-    ImTriangulatorNode*     Next;
-    ImTriangulatorNode*     Prev;
-
-    void    Unlink()        { Next->Prev = Prev; Prev->Next = Next; }
+    bool                    InStatus;
+    bool                    EdgeVisited;    // Edge (this, Next) was assigned to a monotone piece
 };
 
-struct ImTriangulatorNodeSpan
+struct ImTriangulatorEvent
 {
-    ImTriangulatorNode**    Data = NULL;
-    int                     Size = 0;
+    ImVec2                  Pos;
+    int                     Index;
+};
 
-    void    push_back(ImTriangulatorNode* node) { Data[Size++] = node; }
-    void    find_erase_unsorted(int idx)        { for (int i = Size - 1; i >= 0; i--) if (Data[i]->Index == idx) { Data[i] = Data[Size - 1]; Size--; return; } }
+struct ImTriangulatorDiagonal
+{
+    int                     From;
+    int                     To;
+    int                     NextOut;        // Next diagonal leaving 'From', or -1
+    bool                    Visited;
 };
 
 struct ImTriangulator
 {
-    static int EstimateTriangleCount(int points_count)      { return (points_count < 3) ? 0 : points_count - 2; }
-    static int EstimateScratchBufferSize(int points_count)  { return sizeof(ImTriangulatorNode) * points_count + sizeof(ImTriangulatorNode*) * points_count * 2; }
+    static int EstimateTriangleCount(int points_count, int holes_count = 0)  { return (points_count < 3) ? 0 : points_count - 2 + holes_count * 2; }
+    static int EstimateScratchBufferSize(int points_count, int holes_count = 0);
+    static float CalcSignedArea(const ImVec2* points, int points_count);    // > 0.0f for clockwise contours (on screen, with Y axis pointing down)
 
     void    Init(const ImVec2* points, int points_count, void* scratch_buffer);
+    void    Init(const ImVec2* points, const int* contours_points_count, int contours_count, void* scratch_buffer);
     void    GetNextTriangle(unsigned int out_triangle[3]);     // Return relative indexes for next triangle
 
     // Internal functions
-    void    BuildNodes(const ImVec2* points, int points_count);
-    void    BuildReflexes();
-    void    BuildEars();
-    void    FlipNodeList();
-    bool    IsEar(int i0, int i1, int i2, const ImVec2& v0, const ImVec2& v1, const ImVec2& v2) const;
-    void    ReclassifyNode(ImTriangulatorNode* node);
+    void    BuildNodes(const ImVec2* points, const int* contours_points_count, int contours_count);
+    void    BuildMonotonePieces();
+    void    TriangulateMonotonePieces();
+    void    TriangulateMonotonePiece(const int* piece, int piece_size);
+    void    AddDiagonal(int n0, int n1);
+    void    AddTriangle(int n0, int n1, int n2);
+    float   GetEdgeXAt(int edge, float y) const;
+    int     FindStatusEdgeLeftOf(const ImVec2& pos) const;
+    void    StatusInsert(int edge);
+    void    StatusErase(int edge);
+    void    StatusReplace(int edge, int new_edge);
+    void    StatusRotateUp(int edge);
 
     // Internal members
     int                     _TrianglesLeft = 0;
+    int                     _TrianglesCount = 0;
+    int                     _TrianglesCapacity = 0;
+    unsigned int*           _Triangles = NULL;
     ImTriangulatorNode*     _Nodes = NULL;
-    ImTriangulatorNodeSpan  _Ears;
-    ImTriangulatorNodeSpan  _Reflexes;
+    int                     _NodesCount = 0;
+    ImTriangulatorEvent*    _Events = NULL;
+    int                     _EventsCount = 0;
+    int                     _StatusRoot = -1;
+    ImTriangulatorDiagonal* _Diagonals = NULL;
+    int                     _DiagonalsCount = 0;
+    int*                    _Piece = NULL;          // Nodes of current monotone piece, in contour order
+    int*                    _PieceSorted = NULL;    // Nodes of current monotone piece, in sweep order
+    int*                    _Stack = NULL;
+    ImU8*                   _PieceChain = NULL;     // 0: left chain, 1: right chain
 };
 
-// Distribute storage for nodes, ears and reflexes.
-// FIXME-OPT: if everything is convex, we could report it to caller and let it switch to an convex renderer
-// (this would require first building reflexes to bail to convex if empty, without even building nodes)
-void ImTriangulator::Init(const ImVec2* points, int points_count, void* scratch_buffer)
+// Storage for nodes and sorted events (points_count each), diagonals (at most points_count, as two half-edges each),
+// monotone pieces work buffers (a piece has at most points_count + 2 * diagonals edges) and output triangles.
+int ImTriangulator::EstimateScratchBufferSize(int points_count, int holes_count)
 {
-    IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
-    _TrianglesLeft = EstimateTriangleCount(points_count);
-    _Nodes         = (ImTriangulatorNode*)scratch_buffer;                          // points_count x Node
-    _Ears.Data     = (ImTriangulatorNode**)(_Nodes + points_count);                // points_count x Node*
-    _Reflexes.Data = (ImTriangulatorNode**)(_Nodes + points_count) + points_count; // points_count x Node*
-    BuildNodes(points, points_count);
-    BuildReflexes();
-    BuildEars();
+    const int piece_max = points_count * 3;
+    return (int)(sizeof(ImTriangulatorNode) + sizeof(ImTriangulatorEvent) + sizeof(ImTriangulatorDiagonal) * 2) * points_count
+        + (int)(sizeof(int) * 3 + sizeof(ImU8)) * piece_max + (int)sizeof(unsigned int) * 3 * EstimateTriangleCount(points_count, holes_count);
 }
 
-void ImTriangulator::BuildNodes(const ImVec2* points, int points_count)
+float ImTriangulator::CalcSignedArea(const ImVec2* points, int points_count)
 {
-    for (int i = 0; i < points_count; i++)
-    {
-        _Nodes[i].Type = ImTriangulatorNodeType_Convex;
-        _Nodes[i].Index = i;
-        _Nodes[i].Pos = points[i];
-        _Nodes[i].Next = _Nodes + i + 1;
-        _Nodes[i].Prev = _Nodes + i - 1;
-    }
-    _Nodes[0].Prev = _Nodes + points_count - 1;
-    _Nodes[points_count - 1].Next = _Nodes;
+    // Relative to first point, to preserve precision
+    const ImVec2 o = points[0];
+    float area = 0.0f;
+    for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        area += (points[i0].x - o.x) * (points[i1].y - o.y) - (points[i1].x - o.x) * (points[i0].y - o.y);
+    return area * 0.5f;
 }
 
-void ImTriangulator::BuildReflexes()
+static int IMGUI_CDECL ImTriangulatorEventCompare(const void* lhs, const void* rhs)
 {
-    ImTriangulatorNode* n1 = _Nodes;
-    for (int i = _TrianglesLeft; i >= 0; i--, n1 = n1->Next)
-    {
-        if (ImTriangleIsClockwise(n1->Prev->Pos, n1->Pos, n1->Next->Pos))
-            continue;
-        n1->Type = ImTriangulatorNodeType_Reflex;
-        _Reflexes.push_back(n1);
-    }
+    // Sweep order: from top to bottom (Y axis pointing up), then left to right
+    const ImTriangulatorEvent* a = (const ImTriangulatorEvent*)lhs;
+    const ImTriangulatorEvent* b = (const ImTriangulatorEvent*)rhs;
+    if (a->Pos.y != b->Pos.y)
+        return (a->Pos.y > b->Pos.y) ? -1 : +1;
+    if (a->Pos.x != b->Pos.x)
+        return (a->Pos.x < b->Pos.x) ? -1 : +1;
+    return a->Index - b->Index;
 }
 
-void ImTriangulator::BuildEars()
+// Pseudo-angle of a direction, in [0,4) range, growing counter-clockwise. Cheaper than atan2() and enough to compare directions.
+static inline float ImTriangulatorPseudoAngle(float dx, float dy)
 {
-    ImTriangulatorNode* n1 = _Nodes;
-    for (int i = _TrianglesLeft; i >= 0; i--, n1 = n1->Next)
-    {
-        if (n1->Type != ImTriangulatorNodeType_Convex)
-            continue;
-        if (!IsEar(n1->Prev->Index, n1->Index, n1->Next->Index, n1->Prev->Pos, n1->Pos, n1->Next->Pos))
-            continue;
-        n1->Type = ImTriangulatorNodeType_Ear;
-        _Ears.push_back(n1);
-    }
+    const float d = ImFabs(dx) + ImFabs(dy);
+    if (d == 0.0f)
+        return 0.0f;
+    const float p = dx / d;
+    return (dy < 0.0f) ? 3.0f + p : 1.0f - p;
 }
 
-void ImTriangulator::GetNextTriangle(unsigned int out_triangle[3])
+static inline float ImTriangulatorCross(const ImVec2& a, const ImVec2& b, const ImVec2& c)
 {
-    if (_Ears.Size == 0)
-    {
-        FlipNodeList();
+    return (b.x - a.x) * (c.y - b.y) - (b.y - a.y) * (c.x - b.x);
+}
+
+void ImTriangulator::Init(const ImVec2* points, int points_count, void* scratch_buffer)
+{
+    Init(points, &points_count, 1, scratch_buffer);
+}
+
+// Distribute storage, then triangulate everything at once: GetNextTriangle() only reads back the results.
+// First contour is the outer boundary, following contours are holes. Contours may use any winding order. Contours with less than 3 points are ignored.
+void ImTriangulator::Init(const ImVec2* points, const int* contours_points_count, int contours_count, void* scratch_buffer)
+{
+    IM_ASSERT(scratch_buffer != NULL && contours_count >= 1);
+    int points_count = 0;
+    for (int contour_n = 0; contour_n < contours_count; contour_n++)
+        points_count += contours_points_count[contour_n];
+    IM_ASSERT(points_count >= 3);
+    const int piece_max = points_count * 3;
+    _NodesCount = points_count;
+    _Nodes      = (ImTriangulatorNode*)scratch_buffer;                       // points_count x Node
+    _Events     = (ImTriangulatorEvent*)(void*)(_Nodes + points_count);      // points_count x Event
+    _Diagonals  = (ImTriangulatorDiagonal*)(void*)(_Events + points_count);  // points_count x 2 x Diagonal
+    _Piece      = (int*)(void*)(_Diagonals + points_count * 2);              // piece_max x int
+    _PieceSorted = _Piece + piece_max;                                       // piece_max x int
+    _Stack      = _PieceSorted + piece_max;                                  // piece_max x int
+    _Triangles  = (unsigned int*)(void*)(_Stack + piece_max);                // triangles_count x 3 x unsigned int
+    _TrianglesCapacity = EstimateTriangleCount(points_count, contours_count - 1);
+    _PieceChain = (ImU8*)(void*)(_Triangles + _TrianglesCapacity * 3);       // piece_max x ImU8
+    _TrianglesCount = _TrianglesLeft = 0;
+    _StatusRoot = -1;
+    _DiagonalsCount = 0;
+
+    BuildNodes(points, contours_points_count, contours_count);
+    if (_EventsCount < 3)
+        return;
+    BuildMonotonePieces();
+    TriangulateMonotonePieces();
+    _TrianglesLeft = _TrianglesCount;
+}
 
-        ImTriangulatorNode* node = _Nodes;
-        for (int i = _TrianglesLeft; i >= 0; i--, node = node->Next)
-            node->Type = ImTriangulatorNodeType_Convex;
-        _Reflexes.Size = 0;
-        BuildReflexes();
-        BuildEars();
+void ImTriangulator::BuildNodes(const ImVec2* points, const int* contours_points_count, int contours_count)
+{
+    _EventsCount = 0;
+    for (int contour_n = 0, contour_start = 0; contour_n < contours_count; contour_start += contours_points_count[contour_n++])
+    {
+        const int count = contours_points_count[contour_n];
+        const int last = contour_start + count - 1;
 
-        // If we still don't have ears, it means geometry is degenerated.
-        if (_Ears.Size == 0)
+        // Flip Y axis so the algorithm can be written in its usual form.
+        // Orient outer contour counter-clockwise and holes clockwise, so the interior is always on the left of each edge.
+        const bool valid = (count >= 3);
+        const float area = valid ? CalcSignedArea(points + contour_start, count) : 0.0f;
+        const bool reverse = (contour_n == 0) ? (area > 0.0f) : (area < 0.0f);
+        for (int i = contour_start; i <= last; i++)
         {
-            // Return first triangle available, mimicking the behavior of convex fill.
-            IM_ASSERT(_TrianglesLeft > 0); // Geometry is degenerated
-            _Ears.Data[0] = _Nodes;
-            _Ears.Size    = 1;
+            ImTriangulatorNode* node = &_Nodes[i];
+            node->Pos = ImVec2(points[i].x, -points[i].y);
+            node->Next = !valid ? -1 : (reverse ? ((i == contour_start) ? last : i - 1) : ((i == last) ? contour_start : i + 1));
+            node->Prev = !valid ? -1 : (reverse ? ((i == last) ? contour_start : i + 1) : ((i == contour_start) ? last : i - 1));
+            node->Rank = -1;
+            node->Helper = -1;
+            node->DiagonalHead = -1;
+            node->StatusParent = node->StatusChild[0] = node->StatusChild[1] = -1;
+            node->StatusPriority = (ImU32)i * 2654435761u; // Pseudo-random, keeps tree balanced
+            node->Type = ImTriangulatorNodeType_Regular;
+            node->InStatus = false;
+            node->EdgeVisited = !valid;
+            if (!valid)
+                continue;
+            _Events[_EventsCount].Pos = node->Pos;
+            _Events[_EventsCount].Index = i;
+            _EventsCount++;
         }
     }
+    ImQsort(_Events, (size_t)_EventsCount, sizeof(ImTriangulatorEvent), ImTriangulatorEventCompare);
+    for (int n = 0; n < _EventsCount; n++)
+        _Nodes[_Events[n].Index].Rank = n;
+}
 
-    ImTriangulatorNode* ear = _Ears.Data[--_Ears.Size];
-    out_triangle[0] = ear->Prev->Index;
-    out_triangle[1] = ear->Index;
-    out_triangle[2] = ear->Next->Index;
-
-    ear->Unlink();
-    if (ear == _Nodes)
-        _Nodes = ear->Next;
-
-    ReclassifyNode(ear->Prev);
-    ReclassifyNode(ear->Next);
-    _TrianglesLeft--;
+// X coordinate of an edge crossing the sweep line at height 'y'
+float ImTriangulator::GetEdgeXAt(int edge, float y) const
+{
+    const ImVec2& a = _Nodes[edge].Pos;
+    const ImVec2& b = _Nodes[_Nodes[edge].Next].Pos;
+    if (y >= a.y || a.y == b.y)
+        return a.x;
+    if (y <= b.y)
+        return b.x;
+    return a.x + (b.x - a.x) * ((y - a.y) / (b.y - a.y));
 }
 
-void ImTriangulator::FlipNodeList()
+// Return edge directly on the left of 'pos', or -1
+int ImTriangulator::FindStatusEdgeLeftOf(const ImVec2& pos) const
 {
-    ImTriangulatorNode* prev = _Nodes;
-    ImTriangulatorNode* temp = _Nodes;
-    ImTriangulatorNode* current = _Nodes->Next;
-    prev->Next = prev;
-    prev->Prev = prev;
-    while (current != _Nodes)
+    int left = -1;
+    for (int edge = _StatusRoot; edge != -1; )
     {
-        temp = current->Next;
-
-        current->Next = prev;
-        prev->Prev = current;
-        _Nodes->Next = current;
-        current->Prev = _Nodes;
-
-        prev = current;
-        current = temp;
+        const bool is_left = GetEdgeXAt(edge, pos.y) < pos.x;
+        if (is_left)
+            left = edge;
+        edge = _Nodes[edge].StatusChild[is_left ? 1 : 0];
     }
-    _Nodes = prev;
+    return left;
+}
+
+// Rotate edge above its parent in the sweep status tree
+void ImTriangulator::StatusRotateUp(int edge)
+{
+    ImTriangulatorNode* node = &_Nodes[edge];
+    const int parent = node->StatusParent;
+    ImTriangulatorNode* parent_node = &_Nodes[parent];
+    const int dir = (parent_node->StatusChild[1] == edge) ? 1 : 0;
+    const int moved = node->StatusChild[dir ^ 1];
+    parent_node->StatusChild[dir] = moved;
+    if (moved != -1)
+        _Nodes[moved].StatusParent = parent;
+    node->StatusChild[dir ^ 1] = parent;
+    node->StatusParent = parent_node->StatusParent;
+    parent_node->StatusParent = edge;
+    if (node->StatusParent == -1)
+        _StatusRoot = edge;
+    else
+        _Nodes[node->StatusParent].StatusChild[_Nodes[node->StatusParent].StatusChild[1] == parent ? 1 : 0] = edge;
 }
 
-// A triangle is an ear is no other vertex is inside it. We can test reflexes vertices only (see reference algorithm)
-bool ImTriangulator::IsEar(int i0, int i1, int i2, const ImVec2& v0, const ImVec2& v1, const ImVec2& v2) const
+// Insert edge starting at node 'edge' according to its X coordinate on the sweep line
+void ImTriangulator::StatusInsert(int edge)
 {
-    ImTriangulatorNode** p_end = _Reflexes.Data + _Reflexes.Size;
-    for (ImTriangulatorNode** p = _Reflexes.Data; p < p_end; p++)
+    ImTriangulatorNode* node = &_Nodes[edge];
+    node->StatusParent = node->StatusChild[0] = node->StatusChild[1] = -1;
+    node->InStatus = true;
+    if (_StatusRoot == -1)
     {
-        ImTriangulatorNode* reflex = *p;
-        if (reflex->Index != i0 && reflex->Index != i1 && reflex->Index != i2)
-            if (ImTriangleContainsPoint(v0, v1, v2, reflex->Pos))
-                return false;
+        _StatusRoot = edge;
+        return;
     }
-    return true;
+    for (int parent = _StatusRoot; ; )
+    {
+        const int dir = (GetEdgeXAt(parent, node->Pos.y) < node->Pos.x) ? 1 : 0;
+        const int child = _Nodes[parent].StatusChild[dir];
+        if (child == -1)
+        {
+            _Nodes[parent].StatusChild[dir] = edge;
+            node->StatusParent = parent;
+            break;
+        }
+        parent = child;
+    }
+    while (node->StatusParent != -1 && _Nodes[node->StatusParent].StatusPriority < node->StatusPriority)
+        StatusRotateUp(edge);
 }
 
-void ImTriangulator::ReclassifyNode(ImTriangulatorNode* n1)
+void ImTriangulator::StatusErase(int edge)
 {
-    // Classify node
-    ImTriangulatorNodeType type;
-    const ImTriangulatorNode* n0 = n1->Prev;
-    const ImTriangulatorNode* n2 = n1->Next;
-    if (!ImTriangleIsClockwise(n0->Pos, n1->Pos, n2->Pos))
-        type = ImTriangulatorNodeType_Reflex;
-    else if (IsEar(n0->Index, n1->Index, n2->Index, n0->Pos, n1->Pos, n2->Pos))
-        type = ImTriangulatorNodeType_Ear;
+    ImTriangulatorNode* node = &_Nodes[edge];
+    if (!node->InStatus)
+        return;
+    while (node->StatusChild[0] != -1 && node->StatusChild[1] != -1)
+    {
+        const int child0 = node->StatusChild[0];
+        const int child1 = node->StatusChild[1];
+        StatusRotateUp((_Nodes[child0].StatusPriority > _Nodes[child1].StatusPriority) ? child0 : child1);
+    }
+    const int child = (node->StatusChild[0] != -1) ? node->StatusChild[0] : node->StatusChild[1];
+    if (child != -1)
+        _Nodes[child].StatusParent = node->StatusParent;
+    if (node->StatusParent == -1)
+        _StatusRoot = child;
+    else
+        _Nodes[node->StatusParent].StatusChild[_Nodes[node->StatusParent].StatusChild[1] == edge ? 1 : 0] = child;
+    node->InStatus = false;
+}
+
+// Replace an edge with the one following it along the contour, at the same place in the tree
+void ImTriangulator::StatusReplace(int edge, int new_edge)
+{
+    ImTriangulatorNode* node = &_Nodes[edge];
+    ImTriangulatorNode* new_node = &_Nodes[new_edge];
+    new_node->StatusParent = node->StatusParent;
+    new_node->StatusChild[0] = node->StatusChild[0];
+    new_node->StatusChild[1] = node->StatusChild[1];
+    new_node->StatusPriority = node->StatusPriority;
+    new_node->InStatus = true;
+    node->InStatus = false;
+    for (int dir = 0; dir < 2; dir++)
+        if (new_node->StatusChild[dir] != -1)
+            _Nodes[new_node->StatusChild[dir]].StatusParent = new_edge;
+    if (new_node->StatusParent == -1)
+        _StatusRoot = new_edge;
     else
-        type = ImTriangulatorNodeType_Convex;
+        _Nodes[new_node->StatusParent].StatusChild[_Nodes[new_node->StatusParent].StatusChild[1] == edge ? 1 : 0] = new_edge;
+}
 
-    // Update lists when a type changes
-    if (type == n1->Type)
-        return;
-    if (n1->Type == ImTriangulatorNodeType_Reflex)
-        _Reflexes.find_erase_unsorted(n1->Index);
-    else if (n1->Type == ImTriangulatorNodeType_Ear)
-        _Ears.find_erase_unsorted(n1->Index);
-    if (type == ImTriangulatorNodeType_Reflex)
-        _Reflexes.push_back(n1);
-    else if (type == ImTriangulatorNodeType_Ear)
-        _Ears.push_back(n1);
-    n1->Type = type;
-}
-
-// Use ear-clipping algorithm to triangulate a simple polygon (no self-interaction, no holes).
-// (Reminder: we don't perform any coarse clipping/culling in ImDrawList layer!
-// It is up to caller to ensure not making costly calls that will be outside of visible area.
-// As concave fill is noticeably more expensive than other primitives, be mindful of this...
-// Caller can build AABB of points, and avoid filling if 'draw_list->_CmdHeader.ClipRect.Overlays(points_bb) == false')
-void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+void ImTriangulator::AddDiagonal(int n0, int n1)
 {
-    if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
+    // Diagonals are stored as two half-edges. There is at most one diagonal per split or merge node, so we should never run out of space.
+    if (n0 < 0 || n1 < 0 || n0 == n1 || _DiagonalsCount + 2 > _NodesCount * 2)
         return;
+    for (int n = 0; n < 2; n++)
+    {
+        ImTriangulatorDiagonal* diag = &_Diagonals[_DiagonalsCount];
+        diag->From = n ? n1 : n0;
+        diag->To = n ? n0 : n1;
+        diag->NextOut = _Nodes[diag->From].DiagonalHead;
+        diag->Visited = false;
+        _Nodes[diag->From].DiagonalHead = _DiagonalsCount++;
+    }
+}
+
+// Sweep nodes from top to bottom, adding diagonals to split polygon into y-monotone pieces.
+// The sweep status holds edges crossing the sweep line which have the interior on their right, sorted from left to right.
+// Each of those edges has a 'helper' node: the last visited node which can be connected to without crossing any edge.
+void ImTriangulator::BuildMonotonePieces()
+{
+    for (int event_n = 0; event_n < _EventsCount; event_n++)
+    {
+        const int i = _Events[event_n].Index;
+        ImTriangulatorNode* node = &_Nodes[i];
+        const ImTriangulatorNode* prev = &_Nodes[node->Prev];
+        const ImTriangulatorNode* next = &_Nodes[node->Next];
+        const bool prev_below = prev->Rank > node->Rank;
+        const bool next_below = next->Rank > node->Rank;
+        const bool convex = ImTriangulatorCross(prev->Pos, node->Pos, next->Pos) > 0.0f;
+        if (prev_below && next_below)
+            node->Type = convex ? ImTriangulatorNodeType_Start : ImTriangulatorNodeType_Split;
+        else if (!prev_below && !next_below)
+            node->Type = convex ? ImTriangulatorNodeType_End : ImTriangulatorNodeType_Merge;
+        else
+            node->Type = ImTriangulatorNodeType_Regular;
 
-    const ImVec2 uv = _Data->TexUvWhitePixel;
-    ImTriangulator triangulator;
-    unsigned int triangle[3];
-    if (Flags & ImDrawListFlags_AntiAliasedFill)
-    {
+        // Close edge ending at this node (prev, node)
+        if (node->Type == ImTriangulatorNodeType_End || node->Type == ImTriangulatorNodeType_Merge || (node->Type == ImTriangulatorNodeType_Regular && !prev_below))
+        {
+            const int helper = prev->Helper;
+            if (helper >= 0 && _Nodes[helper].Type == ImTriangulatorNodeType_Merge)
+                AddDiagonal(i, helper);
+            if (node->Type == ImTriangulatorNodeType_Regular && prev->InStatus)
+            {
+                StatusReplace(node->Prev, i); // Replace (prev, node) with (node, next)
+                node->Helper = i;
+                continue;
+            }
+            StatusErase(node->Prev);
+            if (node->Type == ImTriangulatorNodeType_End)
+                continue;
+        }
+
+        // Update edge on the left of this node
+        const int left_edge = (node->Type != ImTriangulatorNodeType_Start) ? FindStatusEdgeLeftOf(node->Pos) : -1;
+        if (left_edge != -1)
+        {
+            ImTriangulatorNode* left = &_Nodes[left_edge];
+            if (left->Helper >= 0 && (node->Type == ImTriangulatorNodeType_Split || _Nodes[left->Helper].Type == ImTriangulatorNodeType_Merge))
+                AddDiagonal(i, left->Helper);
+            left->Helper = i;
+        }
+
+        // Open edge starting at this node (node, next)
+        if (node->Type == ImTriangulatorNodeType_Start || node->Type == ImTriangulatorNodeType_Split || (node->Type == ImTriangulatorNodeType_Regular && !prev_below))
+        {
+            StatusInsert(i);
+            node->Helper = i;
+        }
+    }
+}
+
+// Walk pieces delimited by contour edges and diagonals (with the interior on the left), and triangulate each of them.
+// Half-edges are identified by 'n' for contour edge (n, Next), and '_NodesCount + n' for _Diagonals[n].
+void ImTriangulator::TriangulateMonotonePieces()
+{
+    const int piece_max = _NodesCount * 3;
+    for (int start = 0; start < _NodesCount + _DiagonalsCount; start++)
+    {
+        if (start < _NodesCount ? _Nodes[start].EdgeVisited : _Diagonals[start - _NodesCount].Visited)
+            continue;
+        int piece_size = 0;
+        for (int edge = start; piece_size < piece_max; )
+        {
+            int from, to;
+            if (edge < _NodesCount)
+            {
+                _Nodes[edge].EdgeVisited = true;
+                from = edge;
+                to = _Nodes[edge].Next;
+            }
+            else
+            {
+                ImTriangulatorDiagonal* diag = &_Diagonals[edge - _NodesCount];
+                diag->Visited = true;
+                from = diag->From;
+                to = diag->To;
+            }
+            _Piece[piece_size++] = from;
+
+            // Next edge of the piece is the first one met when turning clockwise around 'to', starting from the direction of 'from'
+            int next_edge = to;
+            if (_Nodes[to].DiagonalHead != -1)
+            {
+                const ImVec2 pos = _Nodes[to].Pos;
+                const float ref_angle = ImTriangulatorPseudoAngle(_Nodes[from].Pos.x - pos.x, _Nodes[from].Pos.y - pos.y);
+                const ImVec2 next_pos = _Nodes[_Nodes[to].Next].Pos;
+                float best_d = ref_angle - ImTriangulatorPseudoAngle(next_pos.x - pos.x, next_pos.y - pos.y);
+                if (best_d <= 0.0f)
+                    best_d += 4.0f;
+                for (int diag_n = _Nodes[to].DiagonalHead; diag_n != -1; diag_n = _Diagonals[diag_n].NextOut)
+                {
+                    const ImVec2 diag_pos = _Nodes[_Diagonals[diag_n].To].Pos;
+                    float d = ref_angle - ImTriangulatorPseudoAngle(diag_pos.x - pos.x, diag_pos.y - pos.y);
+                    if (d <= 0.0f)
+                        d += 4.0f;
+                    if (d < best_d)
+                    {
+                        best_d = d;
+                        next_edge = _NodesCount + diag_n;
+                    }
+                }
+            }
+            if (next_edge < _NodesCount ? _Nodes[next_edge].EdgeVisited : _Diagonals[next_edge - _NodesCount].Visited)
+                break;
+            edge = next_edge;
+        }
+        if (piece_size >= 3)
+            TriangulateMonotonePiece(_Piece, piece_size);
+    }
+}
+
+void ImTriangulator::AddTriangle(int n0, int n1, int n2)
+{
+    // Malformed input (e.g. self-intersecting) may produce more triangles than expected
+    if (_TrianglesCount == _TrianglesCapacity)
+        return;
+    unsigned int* out = _Triangles + _TrianglesCount * 3;
+    out[0] = (unsigned int)n0;
+    out[1] = (unsigned int)n1;
+    out[2] = (unsigned int)n2;
+    _TrianglesCount++;
+}
+
+// Triangulate a y-monotone piece in linear time, using a stack of nodes still missing triangles.
+void ImTriangulator::TriangulateMonotonePiece(const int* piece, int piece_size)
+{
+    if (piece_size == 3)
+    {
+        AddTriangle(piece[0], piece[1], piece[2]);
+        return;
+    }
+
+    // Merge left chain (going forward from top node) and right chain (going backward from top node) into sweep order
+    int top = 0, bottom = 0;
+    for (int n = 1; n < piece_size; n++)
+    {
+        if (_Nodes[piece[n]].Rank < _Nodes[piece[top]].Rank)
+            top = n;
+        if (_Nodes[piece[n]].Rank > _Nodes[piece[bottom]].Rank)
+            bottom = n;
+    }
+    int* sorted = _PieceSorted;
+    ImU8* chain = _PieceChain;
+    int sorted_count = 0;
+    sorted[sorted_count] = piece[top];
+    chain[sorted_count++] = 0;
+    for (int l = (top + 1) % piece_size, r = (top + piece_size - 1) % piece_size; l != bottom || r != bottom; )
+    {
+        const bool take_left = (r == bottom) || (l != bottom && _Nodes[piece[l]].Rank < _Nodes[piece[r]].Rank);
+        sorted[sorted_count] = take_left ? piece[l] : piece[r];
+        chain[sorted_count++] = take_left ? 0 : 1;
+        if (take_left)
+            l = (l + 1) % piece_size;
+        else
+            r = (r + piece_size - 1) % piece_size;
+    }
+    sorted[sorted_count++] = piece[bottom];
+
+    int* stack = _Stack;
+    int stack_size = 0;
+    stack[stack_size++] = 0;
+    stack[stack_size++] = 1;
+    for (int j = 2; j < sorted_count - 1; j++)
+    {
+        if (chain[j] != chain[stack[stack_size - 1]])
+        {
+            // Opposite chain: connect to all nodes in the stack
+            for (int n = 0; n < stack_size - 1; n++)
+                AddTriangle(sorted[j], sorted[stack[n]], sorted[stack[n + 1]]);
+            stack[0] = j - 1;
+            stack[1] = j;
+            stack_size = 2;
+        }
+        else
+        {
+            // Same chain: connect to nodes in the stack as long as the diagonals are inside the piece
+            int last = stack[--stack_size];
+            while (stack_size > 0)
+            {
+                const int top_n = stack[stack_size - 1];
+                const float cross = ImTriangulatorCross(_Nodes[sorted[top_n]].Pos, _Nodes[sorted[last]].Pos, _Nodes[sorted[j]].Pos);
+                if (chain[j] == 0 ? (cross <= 0.0f) : (cross >= 0.0f))
+                    break;
+                AddTriangle(sorted[j], sorted[last], sorted[top_n]);
+                last = top_n;
+                stack_size--;
+            }
+            stack[stack_size++] = last;
+            stack[stack_size++] = j;
+        }
+    }
+
+    // Connect bottom node to all remaining nodes in the stack
+    for (int n = 0; n < stack_size - 1; n++)
+        AddTriangle(sorted[sorted_count - 1], sorted[stack[n]], sorted[stack[n + 1]]);
+}
+
+void ImTriangulator::GetNextTriangle(unsigned int out_triangle[3])
+{
+    IM_ASSERT(_TrianglesLeft > 0);
+    const unsigned int* triangle = _Triangles + (_TrianglesCount - _TrianglesLeft) * 3;
+    out_triangle[0] = triangle[0];
+    out_triangle[1] = triangle[1];
+    out_triangle[2] = triangle[2];
+    _TrianglesLeft--;
+}
+
+// Fill a simple polygon (no self-intersection), see ImTriangulator.
+// (Reminder: we don't perform any coarse clipping/culling in ImDrawList layer!
+// It is up to caller to ensure not making costly calls that will be outside of visible area.
+// As concave fill is noticeably more expensive than other primitives, be mindful of this...
+// Caller can build AABB of points, and avoid filling if 'draw_list->_CmdHeader.ClipRect.Overlays(points_bb) == false')
+void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+{
+    AddConcavePolyFilled(points, &points_count, 1, col);
+}
+
+// Fill a polygon with holes: points of all contours are stored one after the other, first contour is the outer boundary, following ones are holes.
+// Unlike other filled shapes, the anti-aliasing fringe doesn't depend on winding order: each contour is oriented according to its role.
+void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int* contours_points_count, const int contours_count, ImU32 col)
+{
+    if (contours_count < 1 || contours_points_count[0] < 3 || (col & IM_COL32_A_MASK) == 0)
+        return;
+    int points_count = 0;
+    int fringe_points_count = 0;
+    for (int contour_n = 0; contour_n < contours_count; contour_n++)
+    {
+        points_count += contours_points_count[contour_n];
+        if (contours_points_count[contour_n] >= 3)
+            fringe_points_count += contours_points_count[contour_n];
+    }
+
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    ImTriangulator triangulator;
+    unsigned int triangle[3];
+    _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count, contours_count - 1) + sizeof(ImVec2)) / sizeof(ImVec2));
+    triangulator.Init(points, contours_points_count, contours_count, _Data->TempBuffer.Data);
+    const int triangles_count = triangulator._TrianglesLeft;
+    if (Flags & ImDrawListFlags_AntiAliasedFill)
+    {
         // Anti-aliased Fill
         const float AA_SIZE = _FringeScale;
         const ImU32 col_trans = col & ~IM_COL32_A_MASK;
-        const int idx_count = (points_count - 2) * 3 + points_count * 6;
+        const int idx_count = triangles_count * 3 + fringe_points_count * 6;
         const int vtx_count = (points_count * 2);
         PrimReserve(idx_count, vtx_count);
 
         // Add indexes for fill
         unsigned int vtx_inner_idx = _VtxCurrentIdx;
         unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
-
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
         while (triangulator._TrianglesLeft > 0)
         {
             triangulator.GetNextTriangle(triangle);
@@ -2042,47 +3055,66 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
             _IdxWritePtr += 3;
         }
 
-        // Compute normals
+        // Compute normals (this overwrites triangulator scratch buffer)
         _Data->TempBuffer.reserve_discard(points_count);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
-
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        for (int contour_n = 0, contour_start = 0; contour_n < contours_count; contour_start += contours_points_count[contour_n++])
         {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
+            const int contour_end = contour_start + contours_points_count[contour_n];
+            if (contour_end - contour_start < 3)
+            {
+                // Ignored contour: emit unused vertices to keep indexing simple
+                for (int i = contour_start; i < contour_end; i++)
+                {
+                    _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col_trans;
+                    _VtxWritePtr[1].pos = points[i]; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;
+                    _VtxWritePtr += 2;
+                }
+                continue;
+            }
 
-            // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
-            _VtxWritePtr += 2;
+            // Normals point outward for clockwise outer contour and counter-clockwise holes, flip them otherwise
+            const float area = ImTriangulator::CalcSignedArea(points + contour_start, contour_end - contour_start);
+            const float normal_sign = ((contour_n == 0) ? (area < 0.0f) : (area > 0.0f)) ? -1.0f : 1.0f;
+            for (int i0 = contour_end - 1, i1 = contour_start; i1 < contour_end; i0 = i1++)
+            {
+                const ImVec2& p0 = points[i0];
+                const ImVec2& p1 = points[i1];
+                float dx = p1.x - p0.x;
+                float dy = p1.y - p0.y;
+                IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+                temp_normals[i0].x = dy * normal_sign;
+                temp_normals[i0].y = -dx * normal_sign;
+            }
 
-            // Add indexes for fringes
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
-            _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
-            _IdxWritePtr += 6;
+            for (int i0 = contour_end - 1, i1 = contour_start; i1 < contour_end; i0 = i1++)
+            {
+                // Average normals
+                const ImVec2& n0 = temp_normals[i0];
+                const ImVec2& n1 = temp_normals[i1];
+                float dm_x = (n0.x + n1.x) * 0.5f;
+                float dm_y = (n0.y + n1.y) * 0.5f;
+                IM_FIXNORMAL2F(dm_x, dm_y);
+                dm_x *= AA_SIZE * 0.5f;
+                dm_y *= AA_SIZE * 0.5f;
+
+                // Add vertices
+                _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
+                _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+                _VtxWritePtr += 2;
+
+                // Add indexes for fringes
+                _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
+                _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
+                _IdxWritePtr += 6;
+            }
         }
         _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
     else
     {
         // Non Anti-aliased Fill
-        const int idx_count = (points_count - 2) * 3;
+        const int idx_count = triangles_count * 3;
         const int vtx_count = points_count;
         PrimReserve(idx_count, vtx_count);
         for (int i = 0; i < vtx_count; i++)
@@ -2090,8 +3122,6 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
             _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
             _VtxWritePtr++;
         }
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
         while (triangulator._TrianglesLeft > 0)
         {
             triangulator.GetNextTriangle(triangle);
@@ -2110,35 +3140,62 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
 
 void ImDrawListSplitter::ClearFreeMemory()
 {
+    // Current channel of each nesting level is a copy of draw_list->CmdBuffer/IdxBuffer, don't destruct again
+    for (int n = _Parents.Size, base = _Base, current = _Current; base + current < _Channels.Size; n -= 2)
+    {
+        memset(&_Channels[base + current], 0, sizeof(ImDrawChannel));
+        if (n == 0)
+            break;
+        current = _Parents[n - 2];
+        base -= _Parents[n - 1];
+    }
     for (int i = 0; i < _Channels.Size; i++)
     {
-        if (i == _Current)
-            memset(&_Channels[i], 0, sizeof(_Channels[i]));  // Current channel is a copy of CmdBuffer/IdxBuffer, don't destruct again
         _Channels[i]._CmdBuffer.clear();
         _Channels[i]._IdxBuffer.clear();
     }
     _Current = 0;
     _Count = 1;
+    _Base = 0;
     _Channels.clear();
+    _Parents.clear();
 }
 
+// Calling Split() while channels are already split creates a nested level: its channels are stored after the ones of
+// the parent level, and its channel 0 continues the current channel of the parent level. Merge() flattens the
+// innermost level back into that channel and returns to the parent level.
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
     IM_UNUSED(draw_list);
-    IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
-    int old_channels_count = _Channels.Size;
-    if (old_channels_count < channels_count)
+    IM_ASSERT(channels_count >= 1);
+    int base = 0;
+    if (_Count > 1 || _Parents.Size > 0)
+    {
+        _Parents.push_back(_Current);
+        _Parents.push_back(_Count);
+        base = _Base + _Count;
+    }
+    const int old_channels_count = _Channels.Size;
+    if (old_channels_count < base + channels_count)
     {
-        _Channels.reserve(channels_count); // Avoid over reserving since this is likely to stay stable
-        _Channels.resize(channels_count);
+        _Channels.reserve(base + channels_count); // Avoid over reserving since this is likely to stay stable
+        _Channels.resize(base + channels_count);
     }
+    _Base = base;
+    _Current = 0;
     _Count = channels_count;
 
     // Channels[] (24/32 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer
-    // The content of Channels[0] at this point doesn't matter. We clear it to make state tidy in a debugger but we don't strictly need to.
-    // When we switch to the next channel, we'll copy draw_list->_CmdBuffer/_IdxBuffer into Channels[0] and then Channels[1] into draw_list->CmdBuffer/_IdxBuffer
-    memset(&_Channels[0], 0, sizeof(ImDrawChannel));
-    for (int i = 1; i < channels_count; i++)
+    // The content of Channels[base] at this point doesn't matter. We clear it to make state tidy in a debugger but we don't strictly need to.
+    // When we switch to the next channel, we'll copy draw_list->_CmdBuffer/_IdxBuffer into Channels[base] and then Channels[base+1] into draw_list->CmdBuffer/_IdxBuffer
+    // (a nested level may reuse a slot previously used as another channel: free its buffers since draw_list->CmdBuffer/IdxBuffer are the ones in use)
+    if (base < old_channels_count)
+    {
+        _Channels[base]._CmdBuffer.clear();
+        _Channels[base]._IdxBuffer.clear();
+    }
+    memset(&_Channels[base], 0, sizeof(ImDrawChannel));
+    for (int i = base + 1; i < base + channels_count; i++)
     {
         if (i >= old_channels_count)
         {
@@ -2152,75 +3209,94 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
     }
 }
 
-void ImDrawListSplitter::Merge(ImDrawList* draw_list)
+// Flatten channels of current level into channel 0, in a single pass over draw commands and indices.
+// - 'channels_order' is optional: when provided it must contain _Count channel indices, each appearing once, with channels_order[0] == 0.
+//   (channel 0 also holds everything submitted to the draw list before Split(), so it always comes first)
+//   Reordering doesn't move channels: use it instead of shuffling _Channels[] before calling Merge().
+void ImDrawListSplitter::Merge(ImDrawList* draw_list, const int* channels_order)
 {
     // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
-    if (_Count <= 1)
-        return;
-
-    SetCurrentChannel(draw_list, 0);
-    draw_list->_PopUnusedDrawCmd();
-
-    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
-    int new_cmd_buffer_count = 0;
-    int new_idx_buffer_count = 0;
-    ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
-    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
-    for (int i = 1; i < _Count; i++)
+    if (_Count > 1)
     {
-        ImDrawChannel& ch = _Channels[i];
-        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
-            ch._CmdBuffer.pop_back();
+        IM_ASSERT(channels_order == NULL || channels_order[0] == 0);
+        SetCurrentChannel(draw_list, 0);
+        draw_list->_PopUnusedDrawCmd();
 
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
+        // Calculate our final buffer sizes
+        int new_cmd_buffer_count = 0;
+        int new_idx_buffer_count = 0;
+        for (int n = 1; n < _Count; n++)
+        {
+            IM_ASSERT(channels_order == NULL || (channels_order[n] > 0 && channels_order[n] < _Count));
+            ImDrawChannel& ch = _Channels.Data[_Base + (channels_order ? channels_order[n] : n)];
+            if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
+                ch._CmdBuffer.pop_back();
+            new_cmd_buffer_count += ch._CmdBuffer.Size;
+            new_idx_buffer_count += ch._IdxBuffer.Size;
+        }
+        const int old_cmd_buffer_size = draw_list->CmdBuffer.Size;
+        draw_list->CmdBuffer.resize(old_cmd_buffer_size + new_cmd_buffer_count);
+        draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+
+        // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
+        // Fix the incorrect IdxOffset values in each command, and merge each channel first draw command with the previous one if matching.
+        ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + old_cmd_buffer_size;
+        ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+        ImDrawCmd* last_cmd = (old_cmd_buffer_size > 0) ? cmd_write - 1 : NULL;
+        unsigned int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
+        for (int n = 1; n < _Count; n++)
         {
+            ImDrawChannel& ch = _Channels.Data[_Base + (channels_order ? channels_order[n] : n)];
+            const ImDrawCmd* cmd_src = ch._CmdBuffer.Data;
+            const ImDrawCmd* cmd_src_end = cmd_src + ch._CmdBuffer.Size;
+
             // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
             // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
+            if (cmd_src < cmd_src_end && last_cmd != NULL && ImDrawCmd_HeaderCompare(last_cmd, cmd_src) == 0 && last_cmd->UserCallback == NULL && cmd_src->UserCallback == NULL)
             {
-                // Merge previous channel last draw command with current channel first draw command if matching.
-                last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
+                last_cmd->ElemCount += cmd_src->ElemCount;
+                idx_offset += cmd_src->ElemCount;
+                cmd_src++;
             }
+            for (; cmd_src < cmd_src_end; cmd_src++)
+            {
+                *cmd_write = *cmd_src;
+                cmd_write->IdxOffset = idx_offset;
+                idx_offset += cmd_src->ElemCount;
+                last_cmd = cmd_write++;
+            }
+            if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
         }
-        if (ch._CmdBuffer.Size > 0)
-            last_cmd = &ch._CmdBuffer.back();
-        new_cmd_buffer_count += ch._CmdBuffer.Size;
-        new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
-        {
-            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
-            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
-        }
-    }
-    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
-    draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+        draw_list->CmdBuffer.resize((int)(cmd_write - draw_list->CmdBuffer.Data));
+        draw_list->_IdxWritePtr = idx_write;
 
-    // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
-    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
-    ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
-    for (int i = 1; i < _Count; i++)
-    {
-        ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
-        if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
-    }
-    draw_list->_IdxWritePtr = idx_write;
+        // Ensure there's always a non-callback draw command trailing the command-buffer
+        if (draw_list->CmdBuffer.Size == 0 || draw_list->CmdBuffer.back().UserCallback != NULL)
+            draw_list->AddDrawCmd();
 
-    // Ensure there's always a non-callback draw command trailing the command-buffer
-    if (draw_list->CmdBuffer.Size == 0 || draw_list->CmdBuffer.back().UserCallback != NULL)
-        draw_list->AddDrawCmd();
+        // If current command is used with different settings we need to add a new command
+        ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
+        if (curr_cmd->ElemCount == 0)
+            ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TexRef, VtxOffset
+        else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
+            draw_list->AddDrawCmd();
 
-    // If current command is used with different settings we need to add a new command
-    ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount == 0)
-        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TexRef, VtxOffset
-    else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
-        draw_list->AddDrawCmd();
+        // Channels[_Base] is now a copy of draw_list->CmdBuffer/IdxBuffer: clear it so a nested level may safely reuse this slot later.
+        memset(&_Channels.Data[_Base], 0, sizeof(ImDrawChannel));
+    }
 
-    _Count = 1;
+    // Return to parent level
+    if (_Parents.Size > 0)
+    {
+        _Count = _Parents.back(); _Parents.pop_back();
+        _Current = _Parents.back(); _Parents.pop_back();
+        _Base -= _Count;
+    }
+    else
+    {
+        _Current = 0;
+        _Count = 1;
+    }
 }
 
 void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
@@ -2230,11 +3306,11 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
         return;
 
     // Overwrite ImVector (12/16 bytes), four times. This is merely a silly optimization instead of doing .swap()
-    memcpy(&_Channels.Data[_Current]._CmdBuffer, &draw_list->CmdBuffer, sizeof(draw_list->CmdBuffer));
-    memcpy(&_Channels.Data[_Current]._IdxBuffer, &draw_list->IdxBuffer, sizeof(draw_list->IdxBuffer));
+    memcpy(&_Channels.Data[_Base + _Current]._CmdBuffer, &draw_list->CmdBuffer, sizeof(draw_list->CmdBuffer));
+    memcpy(&_Channels.Data[_Base + _Current]._IdxBuffer, &draw_list->IdxBuffer, sizeof(draw_list->IdxBuffer));
     _Current = idx;
-    memcpy(&draw_list->CmdBuffer, &_Channels.Data[idx]._CmdBuffer, sizeof(draw_list->CmdBuffer));
-    memcpy(&draw_list->IdxBuffer, &_Channels.Data[idx]._IdxBuffer, sizeof(draw_list->IdxBuffer));
+    memcpy(&draw_list->CmdBuffer, &_Channels.Data[_Base + idx]._CmdBuffer, sizeof(draw_list->CmdBuffer));
+    memcpy(&draw_list->IdxBuffer, &_Channels.Data[_Base + idx]._IdxBuffer, sizeof(draw_list->IdxBuffer));
     draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
 
     // If current command is used with different settings we need to add a new command
@@ -2247,6 +3323,201 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
         draw_list->AddDrawCmd();
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawListFragment
+//-----------------------------------------------------------------------------
+// - ImDrawListFragment::IsValid()
+// - ImDrawList::FragmentBegin()
+// - ImDrawList::FragmentEnd()
+// - ImDrawList::AddFragment()
+//-----------------------------------------------------------------------------
+
+static int ImDrawListFragmentGetAtlasTexUniqueID(const ImDrawList* draw_list)
+{
+    const ImFontAtlas* atlas = draw_list->_Data->FontAtlas;
+    return (atlas != NULL && atlas->TexData != NULL) ? atlas->TexData->UniqueID : -1;
+}
+
+// Return atlas texture page (ImFontAtlasFlags_MultiPage) matching either 'tex' or 'tex_unique_id', NULL if none.
+static ImFontAtlasPage* ImDrawListFragmentFindAtlasPage(const ImDrawList* draw_list, const ImTextureData* tex, int tex_unique_id)
+{
+    const ImFontAtlas* atlas = draw_list->_Data->FontAtlas;
+    if (atlas == NULL || atlas->Builder == NULL)
+        return NULL;
+    for (ImFontAtlasPage* page : atlas->Builder->Pages)
+        if (page->Tex != NULL && (page->Tex == tex || page->Tex->UniqueID == tex_unique_id))
+            return page;
+    return NULL;
+}
+
+// UV coordinates (including the white pixel used by all shapes) only change along with the atlas texture, so comparing its UniqueID is sufficient.
+// (growing or repacking the atlas always creates a new texture with a new UniqueID)
+// Texture pages never move their glyphs either, but may be released and destroyed once all their glyphs are discarded.
+bool ImDrawListFragment::IsValid(const ImDrawList* draw_list) const
+{
+    if (!Recorded)
+        return false;
+    if (ImDrawListFragmentGetAtlasTexUniqueID(draw_list) != AtlasTexUniqueID)
+        return false;
+    for (int tex_unique_id : AtlasPagesTexUniqueIDs)
+        if (ImDrawListFragmentFindAtlasPage(draw_list, NULL, tex_unique_id) == NULL)
+            return false;
+    return true;
+}
+
+void ImDrawList::FragmentBegin(ImDrawListFragment* fragment)
+{
+    IM_ASSERT(fragment->_VtxStart == -1 && "Already recording this fragment!");
+    fragment->Clear();
+    fragment->AtlasTexUniqueID = ImDrawListFragmentGetAtlasTexUniqueID(this);
+    fragment->_VtxStart = VtxBuffer.Size;
+    fragment->_IdxStart = IdxBuffer.Size;
+}
+
+// Copy everything emitted since FragmentBegin(). The first command may have started before, and we may have crossed a VtxOffset boundary:
+// indices are rebased so each fragment command's VtxOffset and indices are relative to the first recorded vertex.
+void ImDrawList::FragmentEnd(ImDrawListFragment* fragment)
+{
+    IM_ASSERT(fragment->_VtxStart != -1 && "Called FragmentEnd() without FragmentBegin()!");
+    IM_ASSERT(fragment->_VtxStart <= VtxBuffer.Size && fragment->_IdxStart <= IdxBuffer.Size && "Draw list was reset or channels were changed while recording?");
+    IM_ASSERT((Flags & ImDrawListFlags_IdxPacked16) == 0);
+    const unsigned int vtx_start = (unsigned int)fragment->_VtxStart;
+    const unsigned int idx_start = (unsigned int)fragment->_IdxStart;
+    const unsigned int idx_end = (unsigned int)IdxBuffer.Size;
+    fragment->_VtxStart = fragment->_IdxStart = -1;
+    fragment->Recorded = true;
+
+    fragment->VtxBuffer.resize(VtxBuffer.Size - (int)vtx_start);
+    if (fragment->VtxBuffer.Size > 0)
+        memcpy(fragment->VtxBuffer.Data, VtxBuffer.Data + vtx_start, (size_t)fragment->VtxBuffer.Size * sizeof(ImDrawVert));
+    fragment->IdxBuffer.resize((int)(idx_end - idx_start));
+
+    // Find first command overlapping recorded indices
+    int cmd_n = CmdBuffer.Size - 1;
+    while (cmd_n > 0 && CmdBuffer.Data[cmd_n].IdxOffset > idx_start)
+        cmd_n--;
+    for (; cmd_n < CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd* src_cmd = &CmdBuffer.Data[cmd_n];
+        const unsigned int src_idx_begin = ImMax(src_cmd->IdxOffset, idx_start);
+        const unsigned int src_idx_end = src_cmd->IdxOffset + src_cmd->ElemCount;
+        if (src_cmd->ElemCount == 0 || src_idx_end <= idx_start)
+        {
+            IM_ASSERT((src_cmd->UserCallback == NULL || src_cmd->IdxOffset <= idx_start || src_cmd->IdxOffset >= idx_end) && "Callbacks are not supported in ImDrawListFragment!");
+            continue;
+        }
+
+        const unsigned int dst_vtx_offset = ImMax(src_cmd->VtxOffset, vtx_start);
+        ImDrawCmd dst_cmd;
+        dst_cmd.ClipRect = src_cmd->ClipRect;
+        dst_cmd.TexRef = src_cmd->TexRef;
+        dst_cmd.VtxOffset = dst_vtx_offset - vtx_start;
+        dst_cmd.IdxOffset = src_idx_begin - idx_start;
+        dst_cmd.ElemCount = src_idx_end - src_idx_begin;
+        fragment->CmdBuffer.push_back(dst_cmd);
+        if (ImTextureData* tex = dst_cmd.TexRef._TexData)
+            if (ImDrawListFragmentFindAtlasPage(this, tex, -1) != NULL && !fragment->AtlasPagesTexUniqueIDs.contains(tex->UniqueID))
+                fragment->AtlasPagesTexUniqueIDs.push_back(tex->UniqueID);
+
+        const ImDrawIdx* src_idx = IdxBuffer.Data + src_idx_begin;
+        ImDrawIdx* dst_idx = fragment->IdxBuffer.Data + dst_cmd.IdxOffset;
+        const unsigned int idx_rebase = dst_vtx_offset - src_cmd->VtxOffset; // Recorded indices can't reference vertices before 'vtx_start'
+        if (idx_rebase == 0)
+            memcpy(dst_idx, src_idx, (size_t)dst_cmd.ElemCount * sizeof(ImDrawIdx));
+        else
+            for (unsigned int n = 0; n < dst_cmd.ElemCount; n++)
+                dst_idx[n] = (ImDrawIdx)(src_idx[n] - idx_rebase);
+    }
+}
+
+static inline bool ImDrawListFragmentCalcClipRect(const ImDrawCmd& cmd, const ImVec2& offset, const ImVec4& clip_rect, ImVec4* out_clip_rect)
+{
+    *out_clip_rect = ImVec4(ImMax(cmd.ClipRect.x + offset.x, clip_rect.x), ImMax(cmd.ClipRect.y + offset.y, clip_rect.y), ImMin(cmd.ClipRect.z + offset.x, clip_rect.z), ImMin(cmd.ClipRect.w + offset.y, clip_rect.w));
+    return out_clip_rect->x < out_clip_rect->z && out_clip_rect->y < out_clip_rect->w;
+}
+
+// Commands sharing a same VtxOffset are appended together with their vertices, so large fragments may be appended with 16-bit indices,
+// as long as they were recorded with ImDrawListFlags_AllowVtxOffset. Groups with no visible commands are skipped entirely.
+void ImDrawList::AddFragment(const ImDrawListFragment& fragment, const ImVec2& offset)
+{
+    IM_ASSERT(fragment._VtxStart == -1 && "Cannot append a fragment while recording it!");
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    const ImTextureRef backup_tex_ref = _CmdHeader.TexRef;
+    const ImDrawCmd* cmds = fragment.CmdBuffer.Data;
+    const int cmds_count = fragment.CmdBuffer.Size;
+    ImVec4 cmd_clip_rect;
+    for (int group_begin = 0, group_end = 0; group_begin < cmds_count; group_begin = group_end)
+    {
+        bool any_visible = false;
+        for (group_end = group_begin; group_end < cmds_count && cmds[group_end].VtxOffset == cmds[group_begin].VtxOffset; group_end++)
+            any_visible |= ImDrawListFragmentCalcClipRect(cmds[group_end], offset, clip_rect, &cmd_clip_rect);
+        if (!any_visible)
+            continue;
+
+        // Copy vertices
+        const unsigned int src_vtx_offset = cmds[group_begin].VtxOffset;
+        const int vtx_count = (int)((group_end < cmds_count ? cmds[group_end].VtxOffset : (unsigned int)fragment.VtxBuffer.Size) - src_vtx_offset);
+        IM_ASSERT((sizeof(ImDrawIdx) == 4 || vtx_count < (1 << 16)) && "Fragment was recorded without ImDrawListFlags_AllowVtxOffset and is too large for 16-bit indices!");
+        PrimReserve(0, vtx_count);
+        const ImDrawVert* src_vtx = fragment.VtxBuffer.Data + src_vtx_offset;
+        if (offset.x == 0.0f && offset.y == 0.0f)
+        {
+            memcpy(_VtxWritePtr, src_vtx, (size_t)vtx_count * sizeof(ImDrawVert));
+        }
+        else
+        {
+            for (int n = 0; n < vtx_count; n++)
+            {
+                _VtxWritePtr[n] = src_vtx[n];
+                _VtxWritePtr[n].pos.x += offset.x;
+                _VtxWritePtr[n].pos.y += offset.y;
+            }
+        }
+        const unsigned int idx_base = _VtxCurrentIdx;
+        _VtxWritePtr += vtx_count;
+        _VtxCurrentIdx += vtx_count;
+
+        // Append commands and indices
+        for (int cmd_n = group_begin; cmd_n < group_end; cmd_n++)
+        {
+            const ImDrawCmd& cmd = cmds[cmd_n];
+            if (!ImDrawListFragmentCalcClipRect(cmd, offset, clip_rect, &cmd_clip_rect))
+                continue;
+            if (_CmdHeader.ClipRect != cmd_clip_rect)
+            {
+                _CmdHeader.ClipRect = cmd_clip_rect;
+                _OnChangedClipRect();
+            }
+            if (_CmdHeader.TexRef != cmd.TexRef)
+            {
+                _CmdHeader.TexRef = cmd.TexRef;
+                _OnChangedTexture();
+            }
+
+            PrimReserve((int)cmd.ElemCount, 0);
+            const ImDrawIdx* src_idx = fragment.IdxBuffer.Data + cmd.IdxOffset;
+            if (idx_base == 0)
+                memcpy(_IdxWritePtr, src_idx, (size_t)cmd.ElemCount * sizeof(ImDrawIdx));
+            else
+                for (unsigned int n = 0; n < cmd.ElemCount; n++)
+                    _IdxWritePtr[n] = (ImDrawIdx)(idx_base + src_idx[n]);
+            _IdxWritePtr += cmd.ElemCount;
+        }
+    }
+
+    // Restore clip rectangle and texture
+    if (_CmdHeader.ClipRect != clip_rect)
+    {
+        _CmdHeader.ClipRect = clip_rect;
+        _OnChangedClipRect();
+    }
+    if (_CmdHeader.TexRef != backup_tex_ref)
+    {
+        _CmdHeader.TexRef = backup_tex_ref;
+        _OnChangedTexture();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawData
 //-----------------------------------------------------------------------------
@@ -2255,9 +3526,14 @@ void ImDrawData::Clear()
 {
     Valid = false;
     CmdListsCount = TotalIdxCount = TotalVtxCount = 0;
+    IdxSize = sizeof(ImDrawIdx);
     CmdLists.resize(0); // The ImDrawList are NOT owned by ImDrawData but e.g. by ImGuiContext, so we don't clear them.
     DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.0f, 0.0f);
     OwnerViewport = NULL;
+    ArenaVtxBuffer = NULL;
+    ArenaIdxBuffer = NULL;
+    ContentHash = 0;
+    Unchanged = false;
     Textures = NULL;
 }
 
@@ -2308,39 +3584,389 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
     draw_data->TotalIdxCount += draw_list->IdxBuffer.Size;
 }
 
-void ImDrawData::AddDrawList(ImDrawList* draw_list)
+void ImDrawData::AddDrawList(ImDrawList* draw_list)
+{
+    IM_ASSERT(CmdLists.Size == CmdListsCount);
+    draw_list->_PopUnusedDrawCmd();
+    ImGui::AddDrawListToDrawDataEx(this, &CmdLists, draw_list);
+}
+
+// Per-list passes below are dispatched with ImGui::ParallelFor(), which uses platform_io.Platform_ParallelForFn when provided.
+// Jobs only read/write memory they own: any allocation happens beforehand on the calling thread.
+struct ImDrawDataDeIndexJob
+{
+    ImDrawList* const*  Lists;
+    ImDrawVert* const*  NewVtxBuffers;          // NULL for lists without indices
+};
+
+static void ImDrawDataDeIndexJobFunc(void* func_data, int list_n)
+{
+    const ImDrawDataDeIndexJob* job = (const ImDrawDataDeIndexJob*)func_data;
+    const ImDrawList* draw_list = job->Lists[list_n];
+    ImDrawVert* dst = job->NewVtxBuffers[list_n];
+    if (dst == NULL)
+        return;
+    for (int j = 0; j < draw_list->IdxBuffer.Size; j++)
+        dst[j] = draw_list->VtxBuffer.Data[ImDrawListGetIdx(draw_list, j)];
+}
+
+// For backward compatibility: convert all buffers from indexed to de-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
+void ImDrawData::DeIndexAllBuffers()
+{
+    IM_ASSERT(ArenaVtxBuffer == NULL && "DeIndexAllBuffers() is not supported after ExportToArena()!");
+    ImVector<ImDrawVert*> new_vtx_buffers;
+    new_vtx_buffers.resize(CmdLists.Size);
+    int work_size = 0;
+    for (int list_n = 0; list_n < CmdLists.Size; list_n++)
+    {
+        const int idx_count = CmdLists[list_n]->IdxBuffer.Size;
+        new_vtx_buffers[list_n] = (idx_count > 0) ? (ImDrawVert*)IM_ALLOC(sizeof(ImDrawVert) * idx_count) : NULL;
+        work_size += idx_count;
+    }
+    ImDrawDataDeIndexJob job = { CmdLists.Data, new_vtx_buffers.Data };
+    ImGui::ParallelFor(CmdLists.Size, work_size, ImDrawDataDeIndexJobFunc, &job);
+
+    TotalVtxCount = TotalIdxCount = 0;
+    for (int list_n = 0; list_n < CmdLists.Size; list_n++)
+    {
+        ImDrawList* draw_list = CmdLists[list_n];
+        if (new_vtx_buffers[list_n] == NULL)
+            continue;
+        ImVector<ImDrawVert> new_vtx_buffer; // Adopt buffer, previous one is freed on scope exit
+        new_vtx_buffer.Data = new_vtx_buffers[list_n];
+        new_vtx_buffer.Size = new_vtx_buffer.Capacity = draw_list->IdxBuffer.Size;
+        draw_list->VtxBuffer.swap(new_vtx_buffer);
+        draw_list->IdxBuffer.resize(0);
+        draw_list->Flags &= ~ImDrawListFlags_IdxPacked16;
+        TotalVtxCount += draw_list->VtxBuffer.Size;
+    }
+    IdxSize = sizeof(ImDrawIdx);
+}
+
+// Convert 32-bit indices to 16-bit in place. Data is written at the beginning of each IdxBuffer[] memory, IdxBuffer.Size is unchanged.
+// - A single build using 32-bit ImDrawIdx can output huge meshes without relying on ImDrawCmd::VtxOffset, and compact buffers for regular frames.
+// - Width is decided for the whole ImDrawData, so backends only need to check IdxSize once:
+//     upload size = IdxBuffer.Size * IdxSize, offset of a command = IdxOffset * IdxSize, index type = (IdxSize == 2) ? 16-bit : 32-bit.
+// - Indices are relative to VtxOffset, so checking VtxBuffer.Size is sufficient.
+// - A persistent draw list submitted again without being reset may have been packed by a previous Render(): it is skipped,
+//   or converted back to 32-bit if the other lists can't be packed.
+bool ImDrawData::PackIndexBuffers()
+{
+    if (IdxSize == 2)
+        return true;
+    if (sizeof(ImDrawIdx) != 4)
+        return false;
+    for (ImDrawList* draw_list : CmdLists)
+        if (draw_list->VtxBuffer.Size > (1 << 16))
+        {
+            for (ImDrawList* packed_list : CmdLists)
+                if (packed_list->Flags & ImDrawListFlags_IdxPacked16)
+                {
+                    const ImU16* src = (const ImU16*)(const void*)packed_list->IdxBuffer.Data;
+                    ImDrawIdx* dst = packed_list->IdxBuffer.Data;
+                    for (int n = packed_list->IdxBuffer.Size - 1; n >= 0; n--)
+                        dst[n] = (ImDrawIdx)src[n]; // Safe in place when iterating backward
+                    packed_list->Flags &= ~ImDrawListFlags_IdxPacked16;
+                }
+            return false;
+        }
+    for (ImDrawList* draw_list : CmdLists)
+    {
+        if (draw_list->Flags & ImDrawListFlags_IdxPacked16)
+            continue;
+        const ImDrawIdx* src = draw_list->IdxBuffer.Data;
+        ImU16* dst = (ImU16*)(void*)draw_list->IdxBuffer.Data;
+        for (int n = 0; n < draw_list->IdxBuffer.Size; n++)
+            dst[n] = (ImU16)src[n]; // Safe in place: write never overtakes read
+        draw_list->Flags |= ImDrawListFlags_IdxPacked16;
+    }
+    IdxSize = 2;
+    return true;
+}
+
+// Helper to scale the ClipRect field of each ImDrawCmd.
+// Use if your final output buffer is at a different scale than draw_data->DisplaySize,
+// or if there is a difference between your window resolution and framebuffer resolution.
+struct ImDrawDataScaleClipRectsJob
+{
+    ImDrawList* const*  Lists;
+    ImVec2              Scale;
+};
+
+static void ImDrawDataScaleClipRectsJobFunc(void* func_data, int list_n)
+{
+    const ImDrawDataScaleClipRectsJob* job = (const ImDrawDataScaleClipRectsJob*)func_data;
+    const ImVec2 fb_scale = job->Scale;
+    for (ImDrawCmd& cmd : job->Lists[list_n]->CmdBuffer)
+        cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
+}
+
+void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
+{
+    int work_size = 0;
+    for (ImDrawList* draw_list : CmdLists)
+        work_size += draw_list->CmdBuffer.Size;
+    ImDrawDataScaleClipRectsJob job = { CmdLists.Data, fb_scale };
+    ImGui::ParallelFor(CmdLists.Size, work_size, ImDrawDataScaleClipRectsJobFunc, &job);
+}
+
+struct ImDrawDataCopyJob
+{
+    ImDrawList* const*  Lists;
+    const ImU32*        Offsets;                // Offsets of each list in destination buffers: [list_n * 2 + 0] = first vertex, [list_n * 2 + 1] = first index
+    ImDrawVert*         VtxDst;
+    char*               IdxDst;
+    int                 IdxSize;
+    bool                RebaseCmdOffsets;
+};
+
+static void ImDrawDataCopyJobFunc(void* func_data, int list_n)
+{
+    const ImDrawDataCopyJob* job = (const ImDrawDataCopyJob*)func_data;
+    ImDrawList* draw_list = job->Lists[list_n];
+    const unsigned int vtx_offset = job->Offsets[list_n * 2 + 0];
+    const unsigned int idx_offset = job->Offsets[list_n * 2 + 1];
+    memcpy(job->VtxDst + vtx_offset, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+    memcpy(job->IdxDst + (size_t)idx_offset * job->IdxSize, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.Size * job->IdxSize);
+    if (!job->RebaseCmdOffsets)
+        return;
+
+    // Offsets may already be rebased if the same list was exported before (e.g. a persistent list added with AddDrawList() every frame)
+    const unsigned int vtx_delta = vtx_offset - draw_list->_ArenaVtxOffset;
+    const unsigned int idx_delta = idx_offset - draw_list->_ArenaIdxOffset;
+    for (ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        cmd.VtxOffset += vtx_delta;
+        cmd.IdxOffset += idx_delta;
+    }
+    draw_list->_ArenaVtxOffset = vtx_offset;
+    draw_list->_ArenaIdxOffset = idx_offset;
+}
+
+// ImDrawData helpers process lists in batches so per-list data fits on the stack: no allocation regardless of the number of lists.
+#define IM_DRAWDATA_LISTS_BATCH_SIZE    256
+
+static void ImDrawDataCopyAllBuffersEx(ImDrawData* draw_data, ImDrawVert* vtx_dst, void* idx_dst, bool rebase_cmd_offsets)
+{
+    ImU32 offsets[IM_DRAWDATA_LISTS_BATCH_SIZE * 2];
+    int vtx_offset = 0, idx_offset = 0;
+    for (int batch_start = 0; batch_start < draw_data->CmdLists.Size; batch_start += IM_DRAWDATA_LISTS_BATCH_SIZE)
+    {
+        const int batch_count = ImMin(draw_data->CmdLists.Size - batch_start, IM_DRAWDATA_LISTS_BATCH_SIZE);
+        const int batch_vtx_offset = vtx_offset, batch_idx_offset = idx_offset;
+        for (int list_n = 0; list_n < batch_count; list_n++)
+        {
+            const ImDrawList* draw_list = draw_data->CmdLists[batch_start + list_n];
+            IM_ASSERT(draw_data->IdxSize == (int)sizeof(ImDrawIdx) || (draw_list->Flags & ImDrawListFlags_IdxPacked16));
+            offsets[list_n * 2 + 0] = (ImU32)vtx_offset;
+            offsets[list_n * 2 + 1] = (ImU32)idx_offset;
+            vtx_offset += draw_list->VtxBuffer.Size;
+            idx_offset += draw_list->IdxBuffer.Size;
+        }
+        ImDrawDataCopyJob job = { draw_data->CmdLists.Data + batch_start, offsets, vtx_dst, (char*)idx_dst, draw_data->IdxSize, rebase_cmd_offsets };
+        ImGui::ParallelFor(batch_count, (vtx_offset - batch_vtx_offset) + (idx_offset - batch_idx_offset), ImDrawDataCopyJobFunc, &job);
+    }
+    IM_ASSERT(vtx_offset == draw_data->TotalVtxCount && idx_offset == draw_data->TotalIdxCount);
+}
+
+// Copy all vertices and indices into contiguous buffers, typically mapped vertex/index buffers of your graphics API, to upload all lists at once.
+// - Lists are laid out in CmdLists[] order. Indices are left unchanged (relative to each list): a renderer drawing from those buffers
+//   needs to add the sum of VtxBuffer.Size/IdxBuffer.Size of previous lists to the VtxOffset/IdxOffset of each command (as most backends already do).
+// - Indices are copied with their current IdxSize, so this may be called after PackIndexBuffers().
+void ImDrawData::CopyAllBuffers(ImDrawVert* vtx_dst, void* idx_dst)
+{
+    ImDrawDataCopyAllBuffersEx(this, vtx_dst, idx_dst, false);
+}
+
+// Copy all vertices and indices into contiguous buffers, then rebase commands on them: draw with
+// (index buffer = idx_dst, first index = IdxOffset, base vertex = VtxOffset) without per-list bookkeeping.
+// - Render() calls this when platform_io.Renderer_GetDrawDataArenaFn is set, letting backends pass mapped GPU buffers,
+//   which saves copying from ImDrawList buffers to their own.
+// - Per-list buffers are left untouched, but ImDrawCmd offsets are not relative to them anymore: don't append to lists
+//   after this (they are reset by the next frame anyway). DeIndexAllBuffers() is not supported after this.
+void ImDrawData::ExportToArena(ImDrawVert* vtx_dst, void* idx_dst)
+{
+    IM_ASSERT(vtx_dst != NULL && (idx_dst != NULL || TotalIdxCount == 0));
+    ImDrawDataCopyAllBuffersEx(this, vtx_dst, idx_dst, true);
+    ArenaVtxBuffer = vtx_dst;
+    ArenaIdxBuffer = idx_dst;
+}
+
+struct ImDrawDataHashJob
+{
+    ImDrawList* const*  Lists;
+    ImU32*              Hashes;
+};
+
+static void ImDrawDataHashJobFunc(void* func_data, int list_n)
+{
+    const ImDrawDataHashJob* job = (const ImDrawDataHashJob*)func_data;
+    job->Hashes[list_n] = job->Lists[list_n]->CalcContentHash();
+}
+
+// Render() calls this when io.ConfigRenderDetectUnchangedFrames is set, to fill ContentHash and Unchanged.
+// Textures contents are not hashed: texture updates need to be checked separately (see Textures[]).
+ImU32 ImDrawData::CalcContentHash() const
+{
+    const ImVec2 display[3] = { DisplayPos, DisplaySize, FramebufferScale };
+    ImU32 hash = ImDrawListHashData(display, sizeof(display), (ImU32)IdxSize);
+    ImU32 hashes[IM_DRAWDATA_LISTS_BATCH_SIZE];
+    for (int batch_start = 0; batch_start < CmdLists.Size; batch_start += IM_DRAWDATA_LISTS_BATCH_SIZE)
+    {
+        const int batch_count = ImMin(CmdLists.Size - batch_start, IM_DRAWDATA_LISTS_BATCH_SIZE);
+        int work_size = 0;
+        for (int list_n = 0; list_n < batch_count; list_n++)
+            work_size += CmdLists[batch_start + list_n]->VtxBuffer.Size + CmdLists[batch_start + list_n]->IdxBuffer.Size;
+        ImDrawDataHashJob job = { CmdLists.Data + batch_start, hashes };
+        ImGui::ParallelFor(batch_count, work_size, ImDrawDataHashJobFunc, &job);
+        hash = ImDrawListHashData(hashes, (size_t)batch_count * sizeof(ImU32), hash);
+    }
+    return hash;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawDataTileTracker
+//-----------------------------------------------------------------------------
+// Single pass over all triangles in draw order, each triangle is hashed once then combined into every tile its bounds overlap.
+// Clip rectangles and triangle bounds are converted to pixels the same way renderers do, so a pixel can
+// only be touched by triangles accounted for in its tile:
+// - clip rectangles are truncated to integer pixels and clamped to framebuffer.
+// - triangles bounding boxes are expanded to whole pixels (rasterizers sample at pixel centers).
+//-----------------------------------------------------------------------------
+
+// Murmur3 mixing step: cheaper than ImHashData() for the millions of small keys we hash here.
+static inline ImU32 ImDrawDataTileHashCombine(ImU32 h, ImU32 k)
+{
+    k *= 0xCC9E2D51;
+    k = (k << 15) | (k >> 17);
+    h ^= k * 0x1B873593;
+    h = (h << 13) | (h >> 19);
+    return h * 5 + 0xE6546B64;
+}
+
+static inline ImU32 ImDrawDataTileHashFloat(ImU32 h, float f)
+{
+    ImU32 bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return ImDrawDataTileHashCombine(h, bits);
+}
+
+static inline ImU32 ImDrawDataTileHashVert(ImU32 h, const ImDrawVert& v)
+{
+    h = ImDrawDataTileHashFloat(h, v.pos.x);
+    h = ImDrawDataTileHashFloat(h, v.pos.y);
+    h = ImDrawDataTileHashFloat(h, v.uv.x);
+    h = ImDrawDataTileHashFloat(h, v.uv.y);
+    return ImDrawDataTileHashCombine(h, v.col);
+}
+
+static void ImDrawDataTileTrackerHashTiles(const ImDrawData* draw_data, ImU32* tile_hashes, int tile_size, int tiles_x, int fb_width, int fb_height)
+{
+    const ImVec2 clip_off = draw_data->DisplayPos;
+    const ImVec2 clip_scale = draw_data->FramebufferScale;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        const ImDrawVert* vtx_buffer = draw_data->ArenaVtxBuffer ? draw_data->ArenaVtxBuffer : draw_list->VtxBuffer.Data;
+        const void* idx_buffer = draw_data->ArenaIdxBuffer ? draw_data->ArenaIdxBuffer : (const void*)draw_list->IdxBuffer.Data;
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            if (cmd.UserCallback != NULL)
+                continue;
+
+            // Clip rectangle in pixels
+            const int clip_x0 = (int)ImMax((cmd.ClipRect.x - clip_off.x) * clip_scale.x, 0.0f);
+            const int clip_y0 = (int)ImMax((cmd.ClipRect.y - clip_off.y) * clip_scale.y, 0.0f);
+            const int clip_x1 = (int)ImMin((cmd.ClipRect.z - clip_off.x) * clip_scale.x, (float)fb_width);
+            const int clip_y1 = (int)ImMin((cmd.ClipRect.w - clip_off.y) * clip_scale.y, (float)fb_height);
+            if (clip_x1 <= clip_x0 || clip_y1 <= clip_y0)
+                continue;
+
+            // Hash texture reference rather than GetTexID(): textures may not be created by renderer yet.
+            ImU32 cmd_hash = ImHashData(&cmd.TexRef._TexData, sizeof(cmd.TexRef._TexData));
+            cmd_hash = ImHashData(&cmd.TexRef._TexID, sizeof(cmd.TexRef._TexID), cmd_hash);
+            cmd_hash = ImDrawDataTileHashCombine(cmd_hash, (ImU32)clip_x0);
+            cmd_hash = ImDrawDataTileHashCombine(cmd_hash, (ImU32)clip_y0);
+            cmd_hash = ImDrawDataTileHashCombine(cmd_hash, (ImU32)clip_x1);
+            cmd_hash = ImDrawDataTileHashCombine(cmd_hash, (ImU32)clip_y1);
+
+            const ImDrawVert* vtx = vtx_buffer + cmd.VtxOffset;
+            for (unsigned int n = 0; n + 2 < cmd.ElemCount; n += 3)
+            {
+                unsigned int idx[3];
+                for (int k = 0; k < 3; k++)
+                    idx[k] = (draw_data->IdxSize == 2) ? ((const ImU16*)idx_buffer)[cmd.IdxOffset + n + k] : ((const ImU32*)idx_buffer)[cmd.IdxOffset + n + k];
+                const ImDrawVert& v0 = vtx[idx[0]];
+                const ImDrawVert& v1 = vtx[idx[1]];
+                const ImDrawVert& v2 = vtx[idx[2]];
+
+                // Pixels whose center may be covered
+                const float min_x = (ImMin(v0.pos.x, ImMin(v1.pos.x, v2.pos.x)) - clip_off.x) * clip_scale.x;
+                const float max_x = (ImMax(v0.pos.x, ImMax(v1.pos.x, v2.pos.x)) - clip_off.x) * clip_scale.x;
+                const float min_y = (ImMin(v0.pos.y, ImMin(v1.pos.y, v2.pos.y)) - clip_off.y) * clip_scale.y;
+                const float max_y = (ImMax(v0.pos.y, ImMax(v1.pos.y, v2.pos.y)) - clip_off.y) * clip_scale.y;
+                if (!(max_x >= (float)clip_x0 && min_x < (float)clip_x1 && max_y >= (float)clip_y0 && min_y < (float)clip_y1)) // Also rejects NaN
+                    continue;
+                const int tile_x0 = (int)ImMax(min_x, (float)clip_x0) / tile_size;
+                const int tile_y0 = (int)ImMax(min_y, (float)clip_y0) / tile_size;
+                const int tile_x1 = (int)ImMin(max_x, (float)(clip_x1 - 1)) / tile_size;
+                const int tile_y1 = (int)ImMin(max_y, (float)(clip_y1 - 1)) / tile_size;
+
+                // Triangle identity depends on its vertices and on command state, and order within a tile matters
+                ImU32 tri_hash = ImDrawDataTileHashVert(cmd_hash, v0);
+                tri_hash = ImDrawDataTileHashVert(tri_hash, v1);
+                tri_hash = ImDrawDataTileHashVert(tri_hash, v2);
+                for (int tile_y = tile_y0; tile_y <= tile_y1; tile_y++)
+                    for (int tile_x = tile_x0; tile_x <= tile_x1; tile_x++)
+                        tile_hashes[tile_y * tiles_x + tile_x] = ImDrawDataTileHashCombine(tile_hashes[tile_y * tiles_x + tile_x], tri_hash);
+            }
+        }
+    }
+}
+
+int ImDrawDataTileTracker::Update(ImDrawData* draw_data)
 {
-    IM_ASSERT(CmdLists.Size == CmdListsCount);
-    draw_list->_PopUnusedDrawCmd();
-    ImGui::AddDrawListToDrawDataEx(this, &CmdLists, draw_list);
-}
+    IM_ASSERT(TileSize > 0);
+    const int fb_width = ImMax((int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x), 0);
+    const int fb_height = ImMax((int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y), 0);
+    const int tiles_x = (fb_width + TileSize - 1) / TileSize;
+    const int tiles_y = (fb_height + TileSize - 1) / TileSize;
 
-// For backward compatibility: convert all buffers from indexed to de-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
-void ImDrawData::DeIndexAllBuffers()
-{
-    ImVector<ImDrawVert> new_vtx_buffer;
-    TotalVtxCount = TotalIdxCount = 0;
-    for (ImDrawList* draw_list : CmdLists)
-    {
-        if (draw_list->IdxBuffer.empty())
-            continue;
-        new_vtx_buffer.resize(draw_list->IdxBuffer.Size);
-        for (int j = 0; j < draw_list->IdxBuffer.Size; j++)
-            new_vtx_buffer[j] = draw_list->VtxBuffer[draw_list->IdxBuffer[j]];
-        draw_list->VtxBuffer.swap(new_vtx_buffer);
-        draw_list->IdxBuffer.resize(0);
-        TotalVtxCount += draw_list->VtxBuffer.Size;
-    }
+    // Any change of layout or projection affects all tiles
+    bool all_dirty = (TileHashes.Size != tiles_x * tiles_y || tiles_x != TilesX || TileSize != _PrevTileSize);
+    all_dirty |= (draw_data->DisplayPos.x != _DisplayPos.x || draw_data->DisplayPos.y != _DisplayPos.y);
+    all_dirty |= (draw_data->FramebufferScale.x != _FramebufferScale.x || draw_data->FramebufferScale.y != _FramebufferScale.y);
+    TilesX = tiles_x;
+    TilesY = tiles_y;
+    _DisplayPos = draw_data->DisplayPos;
+    _FramebufferScale = draw_data->FramebufferScale;
+    _FramebufferSize = ImVec2((float)fb_width, (float)fb_height);
+    _PrevTileSize = TileSize;
+
+    _PrevTileHashes.swap(TileHashes);
+    TileHashes.resize(tiles_x * tiles_y);
+    if (TileHashes.Size > 0)
+        memset(TileHashes.Data, 0, (size_t)TileHashes.size_in_bytes());
+
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+            if (cmd.UserCallback != NULL && cmd.UserCallback != ImDrawCallback_ResetRenderState)
+                all_dirty = true;
+    ImDrawDataTileTrackerHashTiles(draw_data, TileHashes.Data, TileSize, tiles_x, fb_width, fb_height);
+
+    DirtyTiles.resize(0);
+    for (int tile_n = 0; tile_n < TileHashes.Size; tile_n++)
+        if (all_dirty || TileHashes[tile_n] != _PrevTileHashes[tile_n])
+            DirtyTiles.push_back(tile_n);
+    return DirtyTiles.Size;
 }
 
-// Helper to scale the ClipRect field of each ImDrawCmd.
-// Use if your final output buffer is at a different scale than draw_data->DisplaySize,
-// or if there is a difference between your window resolution and framebuffer resolution.
-void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
+void ImDrawDataTileTracker::GetTileRect(int tile_n, ImVec2* out_min, ImVec2* out_max) const
 {
-    for (ImDrawList* draw_list : CmdLists)
-        for (ImDrawCmd& cmd : draw_list->CmdBuffer)
-            cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
+    IM_ASSERT(tile_n >= 0 && tile_n < TilesX * TilesY);
+    const int tile_x = tile_n % TilesX;
+    const int tile_y = tile_n / TilesX;
+    *out_min = ImVec2((float)(tile_x * _PrevTileSize), (float)(tile_y * _PrevTileSize));
+    *out_max = ImVec2(ImMin((float)((tile_x + 1) * _PrevTileSize), _FramebufferSize.x), ImMin((float)((tile_y + 1) * _PrevTileSize), _FramebufferSize.y));
 }
 
 //-----------------------------------------------------------------------------
@@ -2534,6 +4160,7 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasBuildRenderBitmapFromString()
 // - ImFontAtlasBuildUpdateBasicTexData()
 // - ImFontAtlasBuildUpdateLinesTexData()
+// - ImFontAtlasBuildUpdateCornersTexData()
 // - ImFontAtlasBuildAddFont()
 // - ImFontAtlasBuildSetupFontBakedEllipsis()
 // - ImFontAtlasBuildSetupFontBakedBlanks()
@@ -2560,13 +4187,24 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasBuildInit()
 // - ImFontAtlasBuildDestroy()
 //-----------------------------------------------------------------------------
+// - ImFontAtlasBuildIsMultiPage()
+// - ImFontAtlasPageGetTexture()
+// - ImFontAtlasPackGetTexture()
+// - ImFontAtlasPagePackRect()
+//-----------------------------------------------------------------------------
 // - ImFontAtlasPackInit()
 // - ImFontAtlasPackAllocRectEntry()
 // - ImFontAtlasPackReuseRectEntry()
 // - ImFontAtlasPackDiscardRect()
 // - ImFontAtlasPackAddRect()
+// - ImFontAtlasPackAddGlyphRect()
 // - ImFontAtlasPackGetRect()
 //-----------------------------------------------------------------------------
+// - ImFontAtlas::SaveCacheToMemory()
+// - ImFontAtlas::LoadCacheFromMemory()
+// - ImFontAtlas::SaveCacheToFile()
+// - ImFontAtlas::LoadCacheFromFile()
+//-----------------------------------------------------------------------------
 // - ImFontBaked_BuildGrowIndex()
 // - ImFontBaked_BuildLoadGlyph()
 // - ImFontBaked_BuildLoadGlyphAdvanceX()
@@ -2639,6 +4277,7 @@ ImFontAtlas::ImFontAtlas()
     TexMinHeight = 128;
     TexMaxWidth = 8192;
     TexMaxHeight = 8192;
+    TexPageSize = 1024;
     TexRef._TexID = ImTextureID_Invalid;
     RendererHasTextures = false; // Assumed false by default, as apps can call e.g Atlas::Build() after backend init and before ImGui can update.
     TexNextUniqueID = 1;
@@ -2839,6 +4478,10 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
             tex_n--;
         }
     }
+
+    // Commit glyphs rasterized asynchronously (ImFontAtlasFlags_AsyncGlyphLoad)
+    ImFontAtlasBuildStartAsyncGlyphs(atlas);
+    ImFontAtlasBuildCommitAsyncGlyphs(atlas, false);
 }
 
 void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h)
@@ -3348,8 +4991,12 @@ bool ImFontAtlas::GetCustomRect(ImFontAtlasRectId id, ImFontAtlasRect* out_r) co
     out_r->y = r->y;
     out_r->w = r->w;
     out_r->h = r->h;
-    out_r->uv0 = ImVec2((float)(r->x), (float)(r->y)) * TexUvScale;
-    out_r->uv1 = ImVec2((float)(r->x + r->w), (float)(r->y + r->h)) * TexUvScale;
+    ImVec2 uv_scale = TexUvScale;
+    ImTextureData* tex = ImFontAtlasPackGetTexture((ImFontAtlas*)this, id);
+    if (tex != TexData) // Glyph on another texture page (ImFontAtlasFlags_MultiPage)
+        uv_scale = ImVec2(1.0f / tex->Width, 1.0f / tex->Height);
+    out_r->uv0 = ImVec2((float)(r->x), (float)(r->y)) * uv_scale;
+    out_r->uv1 = ImVec2((float)(r->x + r->w), (float)(r->y + r->h)) * uv_scale;
     return true;
 }
 
@@ -3585,6 +5232,81 @@ static void ImFontAtlasBuildUpdateLinesTexData(ImFontAtlas* atlas)
     }
 }
 
+// Register texture region for rounded corners: for each integer radius 'r', a (r+1)*(r+1) square holding the anti-aliased coverage
+// of a quarter of a disc of radius 'r' centered on the square's (r,r) texel corner. The extra row and column duplicate the last ones
+// so bilinear filtering near the circle center doesn't fetch unrelated pixels. Squares are stacked by pairs (r, MAX+1-r) in columns
+// of identical height, which wastes little space.
+// Coverage matches polygon fills with a 1-pixel AA fringe: alpha = Clamp(r + 0.5 - distance_to_center, 0, 1).
+static void ImFontAtlasBuildUpdateCornersTexData(ImFontAtlas* atlas)
+{
+    if (atlas->Flags & ImFontAtlasFlags_NoBakedCorners)
+        return;
+
+    // Pack and store identifier so we can refresh UV coordinates on texture resize.
+    ImTextureData* tex = atlas->TexData;
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    const int radius_max = IM_DRAWLIST_TEX_CORNERS_RADIUS_MAX;
+    const int columns_count = (radius_max + 1) / 2;
+
+    ImFontAtlasRect r;
+    bool add_and_draw = atlas->GetCustomRect(builder->PackIdCornersTexData, &r) == false;
+    if (add_and_draw)
+    {
+        int pack_width = columns_count - 1; // 1 pixel between columns
+        for (int n = 1; n <= columns_count; n++)
+            pack_width += (radius_max + 1 - n) + 1;
+        ImVec2i pack_size = ImVec2i(pack_width, radius_max + 4);
+        builder->PackIdCornersTexData = atlas->AddCustomRect(pack_size.x, pack_size.y, &r);
+        IM_ASSERT(builder->PackIdCornersTexData != ImFontAtlasRectId_Invalid);
+
+        // Clear spacing between squares
+        for (int y = 0; y < r.h; y++)
+        {
+            if (tex->Format == ImTextureFormat_Alpha8)
+                memset(tex->GetPixelsAt(r.x, r.y + y), 0x00, r.w);
+            else if (tex->Format == ImTextureFormat_RGBA32)
+                for (int x = 0; x < r.w; x++)
+                    *(ImU32*)(void*)tex->GetPixelsAt(r.x + x, r.y + y) = IM_COL32(255, 255, 255, 0);
+        }
+    }
+
+    int column_x = 0;
+    for (int n = 1; n <= columns_count; n++)
+    {
+        for (int pair_n = 0; pair_n < 2; pair_n++)
+        {
+            const int radius = pair_n ? radius_max + 1 - n : n;
+            if (pair_n == 1 && radius == n)
+                break;
+            const int x = r.x + column_x;
+            const int y = r.y + (pair_n ? n + 2 : 0);
+            IM_ASSERT(x + radius + 1 <= r.x + r.w && y + radius + 1 <= r.y + r.h); // Make sure we're inside the texture bounds before we start writing pixels
+
+            if (add_and_draw)
+            {
+                for (int ty = 0; ty <= radius; ty++)
+                    for (int tx = 0; tx <= radius; tx++)
+                    {
+                        const float dx = (float)radius - ((float)ImMin(tx, radius - 1) + 0.5f);
+                        const float dy = (float)radius - ((float)ImMin(ty, radius - 1) + 0.5f);
+                        const float alpha = ImSaturate((float)radius + 0.5f - ImSqrt(dx * dx + dy * dy));
+                        const ImU8 alpha8 = (ImU8)(alpha * 255.0f + 0.5f);
+                        if (tex->Format == ImTextureFormat_Alpha8)
+                            *(ImU8*)tex->GetPixelsAt(x + tx, y + ty) = alpha8;
+                        else if (tex->Format == ImTextureFormat_RGBA32)
+                            *(ImU32*)(void*)tex->GetPixelsAt(x + tx, y + ty) = IM_COL32(255, 255, 255, alpha8);
+                    }
+            }
+
+            // Refresh UV coordinates
+            ImVec2 uv0 = ImVec2((float)x, (float)y) * atlas->TexUvScale;
+            ImVec2 uv1 = ImVec2((float)(x + radius), (float)(y + radius)) * atlas->TexUvScale;
+            atlas->TexUvCorners[radius] = ImVec4(uv0.x, uv0.y, uv1.x, uv1.y);
+        }
+        column_x += (radius_max + 1 - n) + 1 + 1;
+    }
+}
+
 //-----------------------------------------------------------------------------------------------------------------------------
 
 // Was tempted to lazily init FontSrc but wouldn't save much + makes it more complicated to detect invalid data at AddFont()
@@ -3601,6 +5323,7 @@ bool ImFontAtlasFontInitOutput(ImFontAtlas* atlas, ImFont* font)
 // Keep source/input FontData
 void ImFontAtlasFontDestroyOutput(ImFontAtlas* atlas, ImFont* font)
 {
+    ImFontAtlasBuildCommitAsyncGlyphs(atlas, true); // Jobs may be reading font sources
     font->ClearOutputData();
     for (ImFontConfig* src : font->Sources)
     {
@@ -3662,12 +5385,14 @@ static ImFontGlyph* ImFontAtlasBuildSetupFontBakedEllipsis(ImFontAtlas* atlas, I
         dot_glyph = baked->FindGlyphNoFallback((ImWchar)0xFF0E);
     if (dot_glyph == NULL)
         return NULL;
+    if (!dot_glyph->Visible && dot_glyph->PackId != ImFontAtlasRectId_Invalid)
+        ImFontAtlasBuildCommitAsyncGlyphs(atlas, true); // We need the dot pixels now (ImFontAtlasFlags_AsyncGlyphLoad)
     ImFontAtlasRectId dot_r_id = dot_glyph->PackId; // Deep copy to avoid invalidation of glyphs and rect pointers
     ImTextureRect* dot_r = ImFontAtlasPackGetRect(atlas, dot_r_id);
     const int dot_spacing = 1;
     const float dot_step = (dot_glyph->X1 - dot_glyph->X0) + dot_spacing;
 
-    ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, (dot_r->w * 3 + dot_spacing * 2), dot_r->h);
+    ImFontAtlasRectId pack_id = ImFontAtlasPackAddGlyphRect(atlas, (dot_r->w * 3 + dot_spacing * 2), dot_r->h);
     ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
 
     ImFontGlyph glyph_in = {};
@@ -3686,9 +5411,10 @@ static ImFontGlyph* ImFontAtlasBuildSetupFontBakedEllipsis(ImFontAtlas* atlas, I
     // Copy to texture, post-process and queue update for backend
     // FIXME-NEWATLAS-V2: Dot glyph is already post-processed as this point, so this would damage it.
     dot_r = ImFontAtlasPackGetRect(atlas, dot_r_id);
-    ImTextureData* tex = atlas->TexData;
+    ImTextureData* dot_tex = ImFontAtlasPackGetTexture(atlas, dot_r_id);
+    ImTextureData* tex = ImFontAtlasPackGetTexture(atlas, pack_id);
     for (int n = 0; n < 3; n++)
-        ImFontAtlasTextureBlockCopy(tex, dot_r->x, dot_r->y, tex, r->x + (dot_r->w + dot_spacing) * n, r->y, dot_r->w, dot_r->h);
+        ImFontAtlasTextureBlockCopy(dot_tex, dot_r->x, dot_r->y, tex, r->x + (dot_r->w + dot_spacing) * n, r->y, dot_r->w, dot_r->h);
     ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
 
     return glyph;
@@ -3782,6 +5508,9 @@ void ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBa
     IM_UNUSED(font);
     baked->IndexLookup[c] = IM_FONTGLYPH_INDEX_UNUSED;
     baked->IndexAdvanceX[c] = baked->FallbackAdvanceX;
+    for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
+        if (shared_data->TextLayoutCache)
+            shared_data->TextLayoutCache->DiscardBaked(baked->BakedId);
 }
 
 ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
@@ -3868,6 +5597,9 @@ void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* bake
     }
     builder->BakedMap.SetVoidPtr(baked->BakedId, NULL);
     builder->BakedDiscardedCount++;
+    for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
+        if (shared_data->TextLayoutCache)
+            shared_data->TextLayoutCache->DiscardBaked(baked->BakedId);
     baked->ClearOutputData();
     baked->WantDestroy = true;
     font->LastBaked = NULL;
@@ -3950,6 +5682,7 @@ void ImFontAtlasUpdateDrawListsSharedData(ImFontAtlas* atlas)
         {
             shared_data->TexUvWhitePixel = atlas->TexUvWhitePixel;
             shared_data->TexUvLines = atlas->TexUvLines;
+            shared_data->TexUvCorners = atlas->TexUvCorners;
         }
 }
 
@@ -4044,6 +5777,14 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
         ImTextureRect& old_r = old_rects[index_entry.TargetIndex];
         if (old_r.w == 0 && old_r.h == 0)
             continue;
+        if (index_entry.PageIndex != 0)
+        {
+            // Rectangles on other pages are left untouched (ImFontAtlasFlags_MultiPage)
+            builder->Rects.push_back(old_r);
+            builder->RectsPackedCount++;
+            index_entry.TargetIndex = builder->Rects.Size - 1;
+            continue;
+        }
         ImFontAtlasRectId new_r_id = ImFontAtlasPackAddRect(atlas, old_r.w, old_r.h, &index_entry);
         if (new_r_id == ImFontAtlasRectId_Invalid)
         {
@@ -4068,7 +5809,7 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
     // Patch glyphs UV
     for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
         for (ImFontGlyph& glyph : builder->BakedPool[baked_n].Glyphs)
-            if (glyph.PackId != ImFontAtlasRectId_Invalid)
+            if (glyph.PackId != ImFontAtlasRectId_Invalid && glyph.PageIndex == 0)
             {
                 ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
                 glyph.U0 = (r->x) * atlas->TexUvScale.x;
@@ -4079,6 +5820,7 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
 
     // Update other cached UV
     ImFontAtlasBuildUpdateLinesTexData(atlas);
+    ImFontAtlasBuildUpdateCornersTexData(atlas);
     ImFontAtlasBuildUpdateBasicTexData(atlas);
 
     builder->LockDisableResize = false;
@@ -4229,6 +5971,7 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 
     // Add required texture data
     ImFontAtlasBuildUpdateLinesTexData(atlas);
+    ImFontAtlasBuildUpdateCornersTexData(atlas);
     ImFontAtlasBuildUpdateBasicTexData(atlas);
 
     // Register fonts
@@ -4243,6 +5986,13 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 // Destroy builder and all cached glyphs. Do not destroy actual fonts.
 void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
 {
+    ImFontAtlasBuildCommitAsyncGlyphs(atlas, true);
+    if (atlas->Builder)
+    {
+        for (ImFontAtlasAsyncJob* job : atlas->Builder->AsyncJobsFree)
+            IM_DELETE(job);
+        atlas->Builder->AsyncJobsFree.clear();
+    }
     for (ImFont* font : atlas->Fonts)
         ImFontAtlasFontDestroyOutput(atlas, font);
     if (atlas->Builder && atlas->FontLoader && atlas->FontLoader->LoaderShutdown)
@@ -4250,10 +6000,100 @@ void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
         atlas->FontLoader->LoaderShutdown(atlas);
         IM_ASSERT(atlas->FontLoaderData == NULL);
     }
+    if (atlas->Builder)
+    {
+        // Pages are normally already released by discarding fonts output above
+        for (ImFontAtlasPage* page : atlas->Builder->Pages)
+        {
+            if (page->Tex != NULL)
+                page->Tex->WantDestroyNextFrame = true;
+            IM_DELETE(page);
+        }
+        atlas->Builder->Pages.clear();
+    }
     IM_DELETE(atlas->Builder);
     atlas->Builder = NULL;
 }
 
+//-----------------------------------------------------------------------------------------------------------------------------
+// Texture pages (ImFontAtlasFlags_MultiPage)
+//-----------------------------------------------------------------------------------------------------------------------------
+// - Growing the main texture requires repacking all rectangles, copying all pixels and patching all glyphs UV, which may
+//   stall for several milliseconds once it holds thousands of glyphs (e.g. CJK text).
+// - Instead, once main texture reached TexPageSize, new glyphs are packed into fixed-size pages allocated on demand.
+//   Cost of adding a glyph stays proportional to its own size, and pages are released once their glyphs are all discarded.
+// - Custom rectangles, mouse cursors and baked lines always stay in main texture.
+// - ImFont::RenderText() submits glyphs on other pages after the rest of the text, with one draw command per page.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+bool ImFontAtlasBuildIsMultiPage(ImFontAtlas* atlas)
+{
+    return (atlas->Flags & ImFontAtlasFlags_MultiPage) && atlas->RendererHasTextures;
+}
+
+ImTextureData* ImFontAtlasPageGetTexture(ImFontAtlas* atlas, int page_idx)
+{
+    return (page_idx == 0) ? atlas->TexData : atlas->Builder->Pages[page_idx - 1]->Tex;
+}
+
+ImTextureData* ImFontAtlasPackGetTexture(ImFontAtlas* atlas, ImFontAtlasRectId id)
+{
+    IM_ASSERT(id != ImFontAtlasRectId_Invalid);
+    ImFontAtlasRectEntry* index_entry = &atlas->Builder->RectsIndex[ImFontAtlasRectId_GetIndex(id)];
+    return ImFontAtlasPageGetTexture(atlas, index_entry->PageIndex);
+}
+
+// Pack into an existing page, into main texture if discarding unused bakes makes enough space, or into a new page.
+// Return page index, -1 on failure.
+static int ImFontAtlasPagePackRect(ImFontAtlas* atlas, stbrp_rect* pack_r)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (int page_n = builder->Pages.Size - 1; page_n >= 0; page_n--) // Most recent first
+    {
+        ImFontAtlasPage* page = builder->Pages[page_n];
+        if (page->Tex == NULL)
+            continue;
+        stbrp_pack_rects((stbrp_context*)(void*)&page->PackContext, pack_r, 1);
+        if (pack_r->was_packed)
+            return page_n + 1;
+    }
+
+    // Same heuristic as ImFontAtlasTextureMakeSpace(), without growing. Discarding may also release whole pages.
+    ImFontAtlasBuildDiscardBakes(atlas, 2);
+    if (builder->RectsDiscardedSurface >= builder->RectsPackedSurface * 0.20f)
+    {
+        ImFontAtlasTextureRepack(atlas, atlas->TexData->Width, atlas->TexData->Height);
+        stbrp_pack_rects((stbrp_context*)(void*)&builder->PackContext, pack_r, 1);
+        if (pack_r->was_packed)
+            return 0;
+    }
+
+    // Reuse a released page or add a new one
+    int page_n = 0;
+    while (page_n < builder->Pages.Size && builder->Pages[page_n]->Tex != NULL)
+        page_n++;
+    if (page_n == builder->Pages.Size)
+    {
+        if (builder->Pages.Size + 1 >= IM_FONTATLAS_PAGES_MAX)
+            return -1;
+        builder->Pages.push_back(IM_NEW(ImFontAtlasPage)());
+    }
+    ImFontAtlasPage* page = builder->Pages[page_n];
+    IM_ASSERT(page->RectsCount == 0 && ImIsPowerOfTwo(atlas->TexPageSize));
+    ImTextureData* tex = IM_NEW(ImTextureData)();
+    tex->UniqueID = atlas->TexNextUniqueID++;
+    tex->Create(atlas->TexData->Format, atlas->TexPageSize, atlas->TexPageSize);
+    tex->UseColors = atlas->TexPixelsUseColors;
+    atlas->TexList.push_back(tex);
+    page->Tex = tex;
+    page->PackNodes.resize(tex->Width / 2);
+    stbrp_init_target((stbrp_context*)(void*)&page->PackContext, tex->Width, tex->Height, page->PackNodes.Data, page->PackNodes.Size);
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: add page %d, %dx%d\n", tex->UniqueID, page_n + 1, tex->Width, tex->Height);
+
+    stbrp_pack_rects((stbrp_context*)(void*)&page->PackContext, pack_r, 1);
+    return pack_r->was_packed ? page_n + 1 : -1;
+}
+
 void ImFontAtlasPackInit(ImFontAtlas * atlas)
 {
     ImTextureData* tex = atlas->TexData;
@@ -4325,13 +6165,27 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     const int pack_padding = atlas->TexGlyphPadding;
     builder->RectsIndexFreeListStart = index_idx;
     builder->RectsDiscardedCount++;
-    builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+    if (index_entry->PageIndex == 0)
+        builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
     rect->w = rect->h = 0; // Clear rectangle so it won't be packed again
+
+    // Release page when its last rectangle is discarded (ImFontAtlasFlags_MultiPage)
+    if (index_entry->PageIndex != 0)
+    {
+        ImFontAtlasPage* page = builder->Pages[index_entry->PageIndex - 1];
+        IM_ASSERT(page->RectsCount > 0);
+        if (--page->RectsCount == 0)
+        {
+            IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: release page %d\n", page->Tex->UniqueID, index_entry->PageIndex);
+            page->Tex->WantDestroyNextFrame = true;
+            page->Tex = NULL;
+        }
+    }
 }
 
 // Important: Calling this may recreate a new texture and therefore change atlas->TexData
 // FIXME-NEWFONTS: Expose other glyph padding settings for custom alteration (e.g. drop shadows). See #7962
-ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry)
+static ImFontAtlasRectId ImFontAtlasPackAddRectEx(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry, bool allow_pages)
 {
     IM_ASSERT(w > 0 && w <= 0xFFFF);
     IM_ASSERT(h > 0 && h <= 0xFFFF);
@@ -4343,6 +6197,7 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
 
     // Pack
     ImTextureRect r = { 0, 0, (unsigned short)w, (unsigned short)h };
+    int page_idx = 0;
     for (int attempts_remaining = 3; attempts_remaining >= 0; attempts_remaining--)
     {
         // Try packing
@@ -4361,52 +6216,438 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
             IMGUI_DEBUG_LOG_FONT("[font] Failed packing %dx%d rectangle. Returning fallback.\n", w, h);
             return ImFontAtlasRectId_Invalid;
         }
-
-        // Resize or repack atlas! (this should be a rare event)
-        ImFontAtlasTextureMakeSpace(atlas);
+
+        // Main texture reached page size: use other pages instead of growing it (ImFontAtlasFlags_MultiPage)
+        if (allow_pages && ImFontAtlasBuildIsMultiPage(atlas) && atlas->TexData->Width >= atlas->TexPageSize && atlas->TexData->Height >= atlas->TexPageSize && pack_r.w <= atlas->TexPageSize && pack_r.h <= atlas->TexPageSize)
+        {
+            page_idx = ImFontAtlasPagePackRect(atlas, &pack_r);
+            if (page_idx < 0)
+            {
+                IMGUI_DEBUG_LOG_FONT("[font] Failed packing %dx%d rectangle: out of pages. Returning fallback.\n", w, h);
+                return ImFontAtlasRectId_Invalid;
+            }
+            r.x = (unsigned short)pack_r.x;
+            r.y = (unsigned short)pack_r.y;
+            break;
+        }
+
+        // Resize or repack atlas! (this should be a rare event)
+        ImFontAtlasTextureMakeSpace(atlas);
+    }
+
+    // Surfaces are only used to resize main texture
+    if (page_idx == 0)
+    {
+        builder->MaxRectBounds.x = ImMax(builder->MaxRectBounds.x, r.x + r.w + pack_padding);
+        builder->MaxRectBounds.y = ImMax(builder->MaxRectBounds.y, r.y + r.h + pack_padding);
+        builder->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
+    }
+    else
+    {
+        builder->Pages[page_idx - 1]->RectsCount++;
+    }
+    builder->RectsPackedCount++;
+
+    builder->Rects.push_back(r);
+    ImFontAtlasRectId r_id;
+    if (overwrite_entry != NULL)
+        r_id = ImFontAtlasPackReuseRectEntry(atlas, overwrite_entry); // Write into an existing entry instead of adding one (used during repack)
+    else
+        r_id = ImFontAtlasPackAllocRectEntry(atlas, builder->Rects.Size - 1);
+    builder->RectsIndex[ImFontAtlasRectId_GetIndex(r_id)].PageIndex = (unsigned int)page_idx;
+    return r_id;
+}
+
+// Rectangles are always packed in main texture (atlas->TexData)
+ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry)
+{
+    return ImFontAtlasPackAddRectEx(atlas, w, h, overwrite_entry, false);
+}
+
+// Glyph rectangles may be packed in another texture page with ImFontAtlasFlags_MultiPage.
+// Caller needs to use ImFontAtlasPackGetTexture() to access pixels, or ImFontAtlasBakedSetFontGlyphBitmap() which does it.
+ImFontAtlasRectId ImFontAtlasPackAddGlyphRect(ImFontAtlas* atlas, int w, int h)
+{
+    return ImFontAtlasPackAddRectEx(atlas, w, h, NULL, true);
+}
+
+// Generally for non-user facing functions: assert on invalid ID.
+ImTextureRect* ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
+{
+    IM_ASSERT(id != ImFontAtlasRectId_Invalid);
+    int index_idx = ImFontAtlasRectId_GetIndex(id);
+    ImFontAtlasBuilder* builder = (ImFontAtlasBuilder*)atlas->Builder;
+    ImFontAtlasRectEntry* index_entry = &builder->RectsIndex[index_idx];
+    IM_ASSERT(index_entry->Generation == ImFontAtlasRectId_GetGeneration(id));
+    IM_ASSERT(index_entry->IsUsed);
+    return &builder->Rects[index_entry->TargetIndex];
+}
+
+// For user-facing functions: return NULL on invalid ID.
+// Important: return pointer is valid until next call to AddRect(), e.g. FindGlyph(), CalcTextSize() can all potentially invalidate previous pointers.
+ImTextureRect* ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId id)
+{
+    if (id == ImFontAtlasRectId_Invalid)
+        return NULL;
+    int index_idx = ImFontAtlasRectId_GetIndex(id);
+    if (atlas->Builder == NULL)
+        ImFontAtlasBuildInit(atlas);
+    ImFontAtlasBuilder* builder = (ImFontAtlasBuilder*)atlas->Builder;
+    IM_MSVC_WARNING_SUPPRESS(28182); // Static Analysis false positive "warning C28182: Dereferencing NULL pointer 'builder'"
+    if (index_idx >= builder->RectsIndex.Size)
+        return NULL;
+    ImFontAtlasRectEntry* index_entry = &builder->RectsIndex[index_idx];
+    if (index_entry->Generation != ImFontAtlasRectId_GetGeneration(id) || !index_entry->IsUsed)
+        return NULL;
+    return &builder->Rects[index_entry->TargetIndex];
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Persistent glyph cache
+//-----------------------------------------------------------------------------------------------------------------------------
+// - SaveCacheToMemory() writes glyph metrics and pixels of all baked fonts, LoadCacheFromMemory() adds them back into an atlas,
+//   so a following run doesn't need to rasterize them again. Fonts are matched by a hash of their sources: TTF data and every
+//   ImFontConfig field affecting output. Unmatched fonts are ignored, and glyphs not in the cache are loaded normally.
+// - Glyph rectangles are packed again on load (the atlas also holds other rectangles), but the texture is created at its
+//   saved size so packing doesn't need to grow it.
+// - Data is in native byte order and only valid for the same texture format and glyph padding.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define IM_FONTATLAS_CACHE_MAGIC    0x43464D49 // "IMFC"
+#define IM_FONTATLAS_CACHE_VERSION  1
+
+struct ImFontAtlasCacheHeader
+{
+    ImU32   Magic;
+    ImU32   Version;
+    int     TexFormat;
+    int     TexGlyphPadding;
+    int     TexWidth, TexHeight;
+    int     FontsCount;
+};
+
+struct ImFontAtlasCacheGlyph
+{
+    ImU32   Codepoint;
+    ImU8    Colored, Visible, SourceIdx, Unused;
+    float   AdvanceX, X0, Y0, X1, Y1;
+    ImU16   Width, Height;  // Followed by Width*Height*BytesPerPixel bytes
+};
+
+static ImGuiID ImFontAtlasCacheHashRanges(const ImWchar* ranges, ImGuiID seed)
+{
+    if (ranges == NULL)
+        return seed;
+    const ImWchar* p = ranges;
+    while (p[0] != 0)
+        p += 2;
+    return ImHashData(ranges, (size_t)(p - ranges) * sizeof(ImWchar), seed);
+}
+
+// Hash TTF data 32 bytes at a time, as ImHashData() (CRC32) would take ~60 ms on a 20 MB CJK font.
+static ImU64 ImFontAtlasCacheHashFontData(const unsigned char* data, size_t data_size)
+{
+    const ImU64 k = 0x9E3779B97F4A7C15ULL;
+    ImU64 lanes[4] = { k, k * 3, k * 5, k * 7 };
+    size_t n = 0;
+    for (; n + 32 <= data_size; n += 32)
+        for (int lane_n = 0; lane_n < 4; lane_n++)
+        {
+            ImU64 v;
+            memcpy(&v, data + n + lane_n * 8, 8);
+            lanes[lane_n] = (lanes[lane_n] ^ v) * k;
+            lanes[lane_n] ^= lanes[lane_n] >> 29;
+        }
+    ImU64 h = (ImU64)data_size;
+    for (int lane_n = 0; lane_n < 4; lane_n++)
+        h = (h ^ lanes[lane_n]) * k;
+    for (; n < data_size; n++)
+        h = (h ^ data[n]) * k;
+    return h ^ (h >> 32);
+}
+
+// Hash everything affecting glyphs of a font.
+static ImGuiID ImFontAtlasCacheGetFontKey(ImFontAtlas* atlas, ImFont* font)
+{
+    ImGuiID h = ImHashStr(atlas->FontLoaderName ? atlas->FontLoaderName : "");
+    h = ImHashData(&atlas->FontLoaderFlags, sizeof(atlas->FontLoaderFlags), h);
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        h = ImHashStr(loader ? loader->Name : "", 0, h);
+        const ImU64 data_hash = ImFontAtlasCacheHashFontData((const unsigned char*)src->FontData, (size_t)src->FontDataSize);
+        h = ImHashData(&data_hash, sizeof(data_hash), h);
+        struct
+        {
+            int FontDataSize; ImU32 FontNo; float SizePixels; ImVec2 GlyphOffset; float GlyphMinAdvanceX, GlyphMaxAdvanceX, GlyphExtraAdvanceX;
+            float RasterizerMultiply, RasterizerDensity; unsigned int FontLoaderFlags; int OversampleH, OversampleV, EllipsisChar, MergeMode, PixelSnapH, PixelSnapV;
+        } cfg;
+        memset(&cfg, 0, sizeof(cfg)); // Clear padding
+        cfg.FontDataSize = src->FontDataSize;
+        cfg.FontNo = src->FontNo;
+        cfg.SizePixels = src->SizePixels;
+        cfg.GlyphOffset = src->GlyphOffset;
+        cfg.GlyphMinAdvanceX = src->GlyphMinAdvanceX;
+        cfg.GlyphMaxAdvanceX = src->GlyphMaxAdvanceX;
+        cfg.GlyphExtraAdvanceX = src->GlyphExtraAdvanceX;
+        cfg.RasterizerMultiply = src->RasterizerMultiply;
+        cfg.RasterizerDensity = src->RasterizerDensity;
+        cfg.FontLoaderFlags = src->FontLoaderFlags;
+        cfg.OversampleH = src->OversampleH;
+        cfg.OversampleV = src->OversampleV;
+        cfg.EllipsisChar = src->EllipsisChar;
+        cfg.MergeMode = src->MergeMode;
+        cfg.PixelSnapH = src->PixelSnapH;
+        cfg.PixelSnapV = src->PixelSnapV;
+        h = ImHashData(&cfg, sizeof(cfg), h);
+        h = ImFontAtlasCacheHashRanges(src->GlyphRanges, h);
+        h = ImFontAtlasCacheHashRanges(src->GlyphExcludeRanges, h);
+    }
+    return h;
+}
+
+static void ImFontAtlasCacheWrite(ImVector<unsigned char>* buf, const void* data, size_t size)
+{
+    int offset = buf->Size;
+    buf->resize(offset + (int)size);
+    memcpy(buf->Data + offset, data, size);
+}
+
+bool ImFontAtlas::SaveCacheToMemory(ImVector<unsigned char>* out_data)
+{
+    out_data->resize(0);
+    ImFontAtlasBuilder* builder = Builder;
+    if (builder == NULL || TexData == NULL || TexData->Pixels == NULL)
+        return false;
+    ImFontAtlasBuildCommitAsyncGlyphs(this, true);
+
+    ImTextureData* tex = TexData;
+    const int bpp = tex->BytesPerPixel;
+    ImFontAtlasCacheHeader header = { IM_FONTATLAS_CACHE_MAGIC, IM_FONTATLAS_CACHE_VERSION, (int)tex->Format, TexGlyphPadding, tex->Width, tex->Height, Fonts.Size };
+    ImFontAtlasCacheWrite(out_data, &header, sizeof(header));
+    for (ImFont* font : Fonts)
+    {
+        int baked_count = 0;
+        for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+            if (builder->BakedPool[baked_n].OwnerFont == font && !builder->BakedPool[baked_n].WantDestroy)
+                baked_count++;
+        ImGuiID font_key = ImFontAtlasCacheGetFontKey(this, font);
+        ImFontAtlasCacheWrite(out_data, &font_key, sizeof(font_key));
+        ImFontAtlasCacheWrite(out_data, &baked_count, sizeof(baked_count));
+
+        for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+        {
+            ImFontBaked& baked = builder->BakedPool[baked_n];
+            if (baked.OwnerFont != font || baked.WantDestroy)
+                continue;
+            const float baked_info[2] = { baked.Size, baked.RasterizerDensity };
+            ImFontAtlasCacheWrite(out_data, baked_info, sizeof(baked_info));
+
+            // Skip synthesized fallback and glyphs which were discarded
+            int glyphs_count_offset = out_data->Size;
+            int glyphs_count = 0;
+            ImFontAtlasCacheWrite(out_data, &glyphs_count, sizeof(glyphs_count));
+            for (int glyph_n = 0; glyph_n < baked.Glyphs.Size; glyph_n++)
+            {
+                const ImFontGlyph* glyph = &baked.Glyphs[glyph_n];
+                if (glyph->Codepoint == 0 || (int)glyph->Codepoint >= baked.IndexLookup.Size || baked.IndexLookup[glyph->Codepoint] != glyph_n)
+                    continue;
+                ImTextureRect* r = (glyph->PackId != ImFontAtlasRectId_Invalid) ? ImFontAtlasPackGetRect(this, glyph->PackId) : NULL;
+                ImFontAtlasCacheGlyph out_glyph = { glyph->Codepoint, (ImU8)glyph->Colored, (ImU8)glyph->Visible, (ImU8)glyph->SourceIdx, 0,
+                    glyph->AdvanceX, glyph->X0, glyph->Y0, glyph->X1, glyph->Y1, (ImU16)(r ? r->w : 0), (ImU16)(r ? r->h : 0) };
+                ImFontAtlasCacheWrite(out_data, &out_glyph, sizeof(out_glyph));
+                if (r != NULL)
+                {
+                    ImTextureData* page_tex = ImFontAtlasPackGetTexture(this, glyph->PackId);
+                    int pixels_offset = out_data->Size;
+                    out_data->resize(pixels_offset + r->w * r->h * bpp);
+                    ImFontAtlasTextureBlockConvert((const unsigned char*)page_tex->GetPixelsAt(r->x, r->y), page_tex->Format, page_tex->GetPitch(), out_data->Data + pixels_offset, page_tex->Format, r->w * bpp, r->w, r->h);
+                }
+                glyphs_count++;
+            }
+            memcpy(out_data->Data + glyphs_count_offset, &glyphs_count, sizeof(glyphs_count));
+        }
+    }
+    return true;
+}
+
+// Walk all records before modifying the atlas, so truncated or corrupted data is rejected without side effects.
+static bool ImFontAtlasCacheValidate(const unsigned char* p, const unsigned char* p_end, const ImFontAtlasCacheHeader* header, int bpp)
+{
+    if (header->FontsCount < 0 || header->TexWidth <= 0 || header->TexHeight <= 0)
+        return false;
+    for (int font_n = 0; font_n < header->FontsCount; font_n++)
+    {
+        int baked_count;
+        if (p_end - p < (ptrdiff_t)(sizeof(ImGuiID) + sizeof(baked_count)))
+            return false;
+        memcpy(&baked_count, p + sizeof(ImGuiID), sizeof(baked_count));
+        p += sizeof(ImGuiID) + sizeof(baked_count);
+        if (baked_count < 0)
+            return false;
+        for (int baked_n = 0; baked_n < baked_count; baked_n++)
+        {
+            float baked_info[2];
+            int glyphs_count;
+            if (p_end - p < (ptrdiff_t)(sizeof(baked_info) + sizeof(glyphs_count)))
+                return false;
+            memcpy(baked_info, p, sizeof(baked_info));
+            memcpy(&glyphs_count, p + sizeof(baked_info), sizeof(glyphs_count));
+            p += sizeof(baked_info) + sizeof(glyphs_count);
+            if (!(baked_info[0] > 0.0f && baked_info[1] > 0.0f) || glyphs_count < 0)
+                return false;
+            for (int glyph_n = 0; glyph_n < glyphs_count; glyph_n++)
+            {
+                ImFontAtlasCacheGlyph in_glyph;
+                if (p_end - p < (ptrdiff_t)sizeof(in_glyph))
+                    return false;
+                memcpy(&in_glyph, p, sizeof(in_glyph));
+                p += sizeof(in_glyph);
+                const size_t pixels_size = (size_t)in_glyph.Width * in_glyph.Height * bpp;
+                if ((size_t)(p_end - p) < pixels_size)
+                    return false;
+                p += pixels_size;
+            }
+        }
+    }
+    return p == p_end;
+}
+
+// Call after adding fonts. Return false if data is invalid or was saved with a different texture format or glyph padding.
+// The atlas is left untouched when returning false.
+bool ImFontAtlas::LoadCacheFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas!");
+    const unsigned char* p = (const unsigned char*)data;
+    const unsigned char* p_end = p + data_size;
+    ImFontAtlasCacheHeader header;
+    if (data_size < sizeof(header))
+        return false;
+    memcpy(&header, p, sizeof(header));
+    p += sizeof(header);
+    if (header.Magic != IM_FONTATLAS_CACHE_MAGIC || header.Version != IM_FONTATLAS_CACHE_VERSION || header.TexFormat != (int)TexDesiredFormat || header.TexGlyphPadding != TexGlyphPadding)
+        return false;
+    const int bpp = ImTextureDataGetFormatBytesPerPixel((ImTextureFormat)header.TexFormat);
+    if (!ImFontAtlasCacheValidate(p, p_end, &header, bpp))
+        return false;
+
+    // Same as ImFontAtlasBuildMain(), without preloading glyphs for legacy backends
+    if (TexData && TexData->Format != TexDesiredFormat)
+        ImFontAtlasBuildClear(this);
+    if (Builder == NULL)
+        ImFontAtlasBuildInit(this);
+    if (Sources.Size == 0)
+        AddFontDefault();
+
+    ImGuiStorage fonts_by_key;
+    for (ImFont* font : Fonts)
+    {
+        ImGuiID font_key = ImFontAtlasCacheGetFontKey(this, font);
+        if (fonts_by_key.GetVoidPtr(font_key) == NULL)
+            fonts_by_key.SetVoidPtr(font_key, font);
+    }
+
+    // Read records, sizes were checked by ImFontAtlasCacheValidate()
+    bool tex_resized = false;
+    int loaded_glyphs_count = 0;
+    for (int font_n = 0; font_n < header.FontsCount; font_n++)
+    {
+        ImGuiID font_key;
+        int baked_count;
+        memcpy(&font_key, p, sizeof(font_key));
+        memcpy(&baked_count, p + sizeof(font_key), sizeof(baked_count));
+        p += sizeof(font_key) + sizeof(baked_count);
+        ImFont* font = (ImFont*)fonts_by_key.GetVoidPtr(font_key);
+
+        for (int baked_n = 0; baked_n < baked_count; baked_n++)
+        {
+            float baked_info[2];
+            int glyphs_count;
+            memcpy(baked_info, p, sizeof(baked_info));
+            memcpy(&glyphs_count, p + sizeof(baked_info), sizeof(glyphs_count));
+            p += sizeof(baked_info) + sizeof(glyphs_count);
+            ImFontBaked* baked = NULL;
+            if (font != NULL)
+            {
+                // Create texture at its saved size, to avoid repeatedly growing it while adding glyphs
+                const int tex_max_w = ImFontAtlasBuildIsMultiPage(this) ? ImMin(TexMaxWidth, TexPageSize) : TexMaxWidth;
+                const int tex_max_h = ImFontAtlasBuildIsMultiPage(this) ? ImMin(TexMaxHeight, TexPageSize) : TexMaxHeight;
+                const int tex_w = ImMin(header.TexWidth, tex_max_w);
+                const int tex_h = ImMin(header.TexHeight, tex_max_h);
+                if (!tex_resized && (tex_w > TexData->Width || tex_h > TexData->Height))
+                    ImFontAtlasTextureRepack(this, ImMax(tex_w, TexData->Width), ImMax(tex_h, TexData->Height));
+                tex_resized = true;
+                baked = ImFontAtlasBakedGetOrAdd(this, font, baked_info[0], baked_info[1]);
+            }
+
+            for (int glyph_n = 0; glyph_n < glyphs_count; glyph_n++)
+            {
+                ImFontAtlasCacheGlyph in_glyph;
+                memcpy(&in_glyph, p, sizeof(in_glyph));
+                p += sizeof(in_glyph);
+                const unsigned char* pixels = p;
+                const int pixels_size = in_glyph.Width * in_glyph.Height * bpp;
+                p += pixels_size;
+
+                // Skip glyphs already loaded (e.g. space and tab loaded by ImFontAtlasBakedAdd())
+                if (baked == NULL || in_glyph.Codepoint == 0 || in_glyph.Codepoint > IM_UNICODE_CODEPOINT_MAX || in_glyph.SourceIdx >= font->Sources.Size)
+                    continue;
+                if ((int)in_glyph.Codepoint < baked->IndexLookup.Size && baked->IndexLookup[in_glyph.Codepoint] != IM_FONTGLYPH_INDEX_UNUSED)
+                    continue;
+
+                ImFontGlyph glyph;
+                glyph.Codepoint = in_glyph.Codepoint;
+                glyph.Colored = in_glyph.Colored;
+                glyph.Visible = in_glyph.Visible;
+                glyph.SourceIdx = in_glyph.SourceIdx;
+                glyph.AdvanceX = in_glyph.AdvanceX;
+                glyph.X0 = in_glyph.X0;
+                glyph.Y0 = in_glyph.Y0;
+                glyph.X1 = in_glyph.X1;
+                glyph.Y1 = in_glyph.Y1;
+                if (pixels_size > 0)
+                {
+                    glyph.PackId = ImFontAtlasPackAddGlyphRect(this, in_glyph.Width, in_glyph.Height);
+                    if (glyph.PackId == ImFontAtlasRectId_Invalid)
+                        continue;
+                    ImTextureRect* r = ImFontAtlasPackGetRect(this, glyph.PackId);
+                    ImTextureData* tex = ImFontAtlasPackGetTexture(this, glyph.PackId);
+                    ImFontAtlasTextureBlockConvert(pixels, tex->Format, in_glyph.Width * bpp, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
+                    ImFontAtlasTextureBlockQueueUpload(this, tex, r->x, r->y, r->w, r->h);
+                }
+                ImFontAtlasBakedAddFontGlyph(this, baked, NULL, &glyph); // Metrics were already adjusted for 'src'
+                loaded_glyphs_count++;
+            }
+        }
     }
-
-    builder->MaxRectBounds.x = ImMax(builder->MaxRectBounds.x, r.x + r.w + pack_padding);
-    builder->MaxRectBounds.y = ImMax(builder->MaxRectBounds.y, r.y + r.h + pack_padding);
-    builder->RectsPackedCount++;
-    builder->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
-
-    builder->Rects.push_back(r);
-    if (overwrite_entry != NULL)
-        return ImFontAtlasPackReuseRectEntry(atlas, overwrite_entry); // Write into an existing entry instead of adding one (used during repack)
-    else
-        return ImFontAtlasPackAllocRectEntry(atlas, builder->Rects.Size - 1);
+    IM_ASSERT(p == p_end);
+    IMGUI_DEBUG_LOG_FONT("[font] Loaded %d glyphs from cache.\n", loaded_glyphs_count);
+    IM_UNUSED(loaded_glyphs_count);
+    return true;
 }
 
-// Generally for non-user facing functions: assert on invalid ID.
-ImTextureRect* ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
+bool ImFontAtlas::SaveCacheToFile(const char* filename)
 {
-    IM_ASSERT(id != ImFontAtlasRectId_Invalid);
-    int index_idx = ImFontAtlasRectId_GetIndex(id);
-    ImFontAtlasBuilder* builder = (ImFontAtlasBuilder*)atlas->Builder;
-    ImFontAtlasRectEntry* index_entry = &builder->RectsIndex[index_idx];
-    IM_ASSERT(index_entry->Generation == ImFontAtlasRectId_GetGeneration(id));
-    IM_ASSERT(index_entry->IsUsed);
-    return &builder->Rects[index_entry->TargetIndex];
+    ImVector<unsigned char> data;
+    if (!SaveCacheToMemory(&data))
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    bool ret = ImFileWrite(data.Data, 1, (ImU64)data.Size, f) == (ImU64)data.Size;
+    ImFileClose(f);
+    return ret;
 }
 
-// For user-facing functions: return NULL on invalid ID.
-// Important: return pointer is valid until next call to AddRect(), e.g. FindGlyph(), CalcTextSize() can all potentially invalidate previous pointers.
-ImTextureRect* ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId id)
+bool ImFontAtlas::LoadCacheFromFile(const char* filename)
 {
-    if (id == ImFontAtlasRectId_Invalid)
-        return NULL;
-    int index_idx = ImFontAtlasRectId_GetIndex(id);
-    if (atlas->Builder == NULL)
-        ImFontAtlasBuildInit(atlas);
-    ImFontAtlasBuilder* builder = (ImFontAtlasBuilder*)atlas->Builder;
-    IM_MSVC_WARNING_SUPPRESS(28182); // Static Analysis false positive "warning C28182: Dereferencing NULL pointer 'builder'"
-    if (index_idx >= builder->RectsIndex.Size)
-        return NULL;
-    ImFontAtlasRectEntry* index_entry = &builder->RectsIndex[index_idx];
-    if (index_entry->Generation != ImFontAtlasRectId_GetGeneration(id) || !index_entry->IsUsed)
-        return NULL;
-    return &builder->Rects[index_entry->TargetIndex];
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
+    if (!data)
+        return false;
+    bool ret = LoadCacheFromMemory(data, data_size);
+    IM_FREE(data);
+    return ret;
 }
 
 // Important! This assume by ImFontConfig::GlyphExcludeRanges[] is a SMALL ARRAY (e.g. <10 entries)
@@ -4596,6 +6837,7 @@ static bool ImGui_ImplStbTrueType_FontSrcInit(ImFontAtlas* atlas, ImFontConfig*
         IM_ASSERT_USER_ERROR(0, "stbtt_InitFont(): failed to parse FontData. It is correct and complete? Check FontDataSize.");
         return false;
     }
+    bd_font_data->FontInfo.userdata = NULL; // Allocate with IM_ALLOC(), see ImStbTrueTypeMalloc()
     src->FontLoaderData = bd_font_data;
 
     const float ref_size = src->DstFont->Sources[0]->SizePixels;
@@ -4649,6 +6891,24 @@ static bool ImGui_ImplStbTrueType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig
     return true;
 }
 
+// Same as stbtt__oversample_shift() used by stbtt_MakeGlyphBitmapSubpixelPrefilter(), as we need the value before rasterizing.
+static float ImGui_ImplStbTrueType_OversampleShift(int oversample)
+{
+    return oversample ? (float)-(oversample - 1) / (2.0f * (float)oversample) : 0.0f;
+}
+
+// May be called from a worker thread (ImFontAtlasFlags_AsyncGlyphLoad): use a copy of stbtt_fontinfo to route allocations to 'allocator'.
+static bool ImGui_ImplStbTrueType_FontBakedRasterizeGlyph(const ImFontAtlasAsyncGlyph* glyph, unsigned char* out_pixels, ImFontAtlasAsyncAllocator* allocator)
+{
+    const ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (const ImGui_ImplStbTrueType_FontSrcData*)glyph->LoaderFontSrcData;
+    stbtt_fontinfo font_info = bd_font_data->FontInfo;
+    font_info.userdata = allocator;
+    float sub_x, sub_y;
+    stbtt_MakeGlyphBitmapSubpixelPrefilter(&font_info, out_pixels, glyph->Width, glyph->Height, glyph->Width,
+        glyph->LoaderScaleX, glyph->LoaderScaleY, 0, 0, glyph->LoaderOversampleH, glyph->LoaderOversampleV, &sub_x, &sub_y, glyph->LoaderGlyphIndex);
+    return true;
+}
+
 static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
 {
     // Search for first font which has the glyph
@@ -4691,7 +6951,7 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     {
         const int w = (x1 - x0 + oversample_h - 1);
         const int h = (y1 - y0 + oversample_v - 1);
-        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddGlyphRect(atlas, w, h);
         if (pack_id == ImFontAtlasRectId_Invalid)
         {
             // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
@@ -4700,18 +6960,9 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         }
         ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
 
-        // Render
         stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
-        ImFontAtlasBuilder* builder = atlas->Builder;
-        builder->TempBuffer.resize(w * h * 1);
-        unsigned char* bitmap_pixels = builder->TempBuffer.Data;
-        memset(bitmap_pixels, 0, w * h * 1);
-
-        // Render with oversampling
-        // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
-        float sub_x, sub_y;
-        stbtt_MakeGlyphBitmapSubpixelPrefilter(&bd_font_data->FontInfo, bitmap_pixels, w, h, w,
-            scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
+        const float sub_x = ImGui_ImplStbTrueType_OversampleShift(oversample_h);
+        const float sub_y = ImGui_ImplStbTrueType_OversampleShift(oversample_v);
 
         const float ref_size = baked->OwnerFont->Sources[0]->SizePixels;
         const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
@@ -4735,7 +6986,30 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         out_glyph->Y1 = (y0 + (int)r->h) * recip_v + font_off_y;
         out_glyph->Visible = true;
         out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
+
+        if (ImFontAtlasBuildIsAsyncGlyphLoad(atlas))
+        {
+            // Rasterize later on a worker thread
+            ImFontAtlasAsyncGlyph* req = ImFontAtlasBakedQueueFontGlyphBitmap(atlas, baked, src, out_glyph, ImTextureFormat_Alpha8);
+            req->LoaderGlyphIndex = glyph_index;
+            req->LoaderScaleX = scale_for_raster_x;
+            req->LoaderScaleY = scale_for_raster_y;
+            req->LoaderOversampleH = oversample_h;
+            req->LoaderOversampleV = oversample_v;
+        }
+        else
+        {
+            // Render with oversampling
+            // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
+            ImFontAtlasBuilder* builder = atlas->Builder;
+            builder->TempBuffer.resize(w * h * 1);
+            unsigned char* bitmap_pixels = builder->TempBuffer.Data;
+            memset(bitmap_pixels, 0, w * h * 1);
+            float unused_sub_x, unused_sub_y;
+            stbtt_MakeGlyphBitmapSubpixelPrefilter(&bd_font_data->FontInfo, bitmap_pixels, w, h, w,
+                scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &unused_sub_x, &unused_sub_y, glyph_index);
+            ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
+        }
     }
 
     return true;
@@ -4751,6 +7025,7 @@ const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
     loader.FontBakedInit = ImGui_ImplStbTrueType_FontBakedInit;
     loader.FontBakedDestroy = NULL;
     loader.FontBakedLoadGlyph = ImGui_ImplStbTrueType_FontBakedLoadGlyph;
+    loader.FontBakedRasterizeGlyph = ImGui_ImplStbTrueType_FontBakedRasterizeGlyph;
     return &loader;
 }
 
@@ -5145,10 +7420,17 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
     {
         ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
         IM_ASSERT(glyph->U0 == 0.0f && glyph->V0 == 0.0f && glyph->U1 == 0.0f && glyph->V1 == 0.0f);
-        glyph->U0 = (r->x) * atlas->TexUvScale.x;
-        glyph->V0 = (r->y) * atlas->TexUvScale.y;
-        glyph->U1 = (r->x + r->w) * atlas->TexUvScale.x;
-        glyph->V1 = (r->y + r->h) * atlas->TexUvScale.y;
+        glyph->PageIndex = atlas->Builder->RectsIndex[ImFontAtlasRectId_GetIndex(glyph->PackId)].PageIndex;
+        ImVec2 uv_scale = atlas->TexUvScale;
+        if (glyph->PageIndex != 0)
+        {
+            ImTextureData* page_tex = ImFontAtlasPageGetTexture(atlas, glyph->PageIndex);
+            uv_scale = ImVec2(1.0f / page_tex->Width, 1.0f / page_tex->Height);
+        }
+        glyph->U0 = (r->x) * uv_scale.x;
+        glyph->V0 = (r->y) * uv_scale.y;
+        glyph->U1 = (r->x + r->w) * uv_scale.x;
+        glyph->V1 = (r->y + r->h) * uv_scale.y;
         baked->MetricsTotalSurface += r->w * r->h;
     }
 
@@ -5173,7 +7455,11 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
         glyph->AdvanceX = advance_x + src->GlyphExtraAdvanceX;
     }
     if (glyph->Colored)
+    {
         atlas->TexPixelsUseColors = atlas->TexData->UseColors = true;
+        if (glyph->PageIndex != 0)
+            ImFontAtlasPageGetTexture(atlas, glyph->PageIndex)->UseColors = true;
+    }
 
     // Update lookup tables
     const int codepoint = glyph->Codepoint;
@@ -5183,6 +7469,14 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
     const int page_n = codepoint / 8192;
     baked->OwnerFont->Used8kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
 
+    // Bitmap queued by ImFontAtlasBakedQueueFontGlyphBitmap()
+    if (!glyph->Visible && glyph->PackId != ImFontAtlasRectId_Invalid)
+    {
+        ImVector<ImFontAtlasAsyncGlyph>& queue = atlas->Builder->AsyncGlyphsQueued;
+        if (queue.Size > 0 && queue.back().PackId == glyph->PackId)
+            queue.back().GlyphIndex = glyph_idx;
+    }
+
     return glyph;
 }
 
@@ -5212,7 +7506,7 @@ void ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* bake
 // Copy to texture, post-process and queue update for backend
 void ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch)
 {
-    ImTextureData* tex = atlas->TexData;
+    ImTextureData* tex = ImFontAtlasPackGetTexture(atlas, glyph->PackId);
     IM_ASSERT(r->x + r->w <= tex->Width && r->y + r->h <= tex->Height);
     ImFontAtlasTextureBlockConvert(src_pixels, src_fmt, src_pitch, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
     ImFontAtlasPostProcessData pp_data = { atlas, baked->OwnerFont, src, baked, glyph, tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h };
@@ -5220,6 +7514,170 @@ void ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked,
     ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
 }
 
+//-----------------------------------------------------------------------------------------------------------------------------
+// Asynchronous glyph rasterization (ImFontAtlasFlags_AsyncGlyphLoad)
+//-----------------------------------------------------------------------------------------------------------------------------
+// - Glyphs are packed and their metrics computed synchronously by ImFontLoader::FontBakedLoadGlyph(), so layout is never affected.
+// - Their bitmaps are queued with ImFontAtlasBakedQueueFontGlyphBitmap() and the glyph stays invisible.
+// - At the end of the frame, queued glyphs are rasterized by one job started with platform_io.Platform_AsyncJobStartFn().
+// - At the beginning of a following frame, bitmaps of completed jobs are copied into the atlas and the glyphs made visible.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+// Return context whose hooks are used to start jobs, or NULL if async loading is unavailable.
+static ImGuiContext* ImFontAtlasBuildGetAsyncContext(ImFontAtlas* atlas)
+{
+    if ((atlas->Flags & ImFontAtlasFlags_AsyncGlyphLoad) == 0 || !atlas->RendererHasTextures || atlas->Builder == NULL)
+        return NULL;
+    ImGuiContext* ctx = atlas->OwnerContext;
+    if (ctx == NULL && atlas->DrawListSharedDatas.Size > 0)
+        ctx = atlas->DrawListSharedDatas[0]->Context;
+    if (ctx == NULL || ctx->PlatformIO.Platform_AsyncJobStartFn == NULL || ctx->PlatformIO.Platform_AsyncJobWaitFn == NULL)
+        return NULL;
+    return ctx;
+}
+
+bool ImFontAtlasBuildIsAsyncGlyphLoad(ImFontAtlas* atlas)
+{
+    return ImFontAtlasBuildGetAsyncContext(atlas) != NULL;
+}
+
+// Called by ImFontLoader::FontBakedLoadGlyph() instead of ImFontAtlasBakedSetFontGlyphBitmap(). Caller fills the Loader-specific fields.
+ImFontAtlasAsyncGlyph* ImFontAtlasBakedQueueFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureFormat fmt)
+{
+    IM_ASSERT(glyph->PackId != ImFontAtlasRectId_Invalid);
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+    builder->AsyncGlyphsQueued.push_back(ImFontAtlasAsyncGlyph());
+    ImFontAtlasAsyncGlyph* req = &builder->AsyncGlyphsQueued.back();
+    memset(req, 0, sizeof(*req));
+    req->BakedId = baked->BakedId;
+    req->GlyphIndex = -1; // Set by ImFontAtlasBakedAddFontGlyph()
+    req->PackId = glyph->PackId;
+    req->Width = r->w;
+    req->Height = r->h;
+    req->Format = fmt;
+    req->Loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+    req->LoaderFontSrcData = src->FontLoaderData;
+    IM_ASSERT(req->Loader->FontBakedRasterizeGlyph != NULL);
+    glyph->Visible = false; // Until committed
+    return req;
+}
+
+static void ImFontAtlasBuildRunAsyncJob(void* func_data)
+{
+    ImFontAtlasAsyncJob* job = (ImFontAtlasAsyncJob*)func_data;
+    for (ImFontAtlasAsyncGlyph& req : job->Glyphs)
+        req.Rasterized = req.Loader->FontBakedRasterizeGlyph(&req, job->Pixels.Data + req.PixelsOffset, &job->Allocator);
+}
+
+static void ImFontAtlasBuildStartAsyncJob(ImFontAtlas* atlas, ImGuiContext* ctx)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontAtlasAsyncJob* job;
+    if (builder->AsyncJobsFree.Size > 0)
+    {
+        job = builder->AsyncJobsFree.back();
+        builder->AsyncJobsFree.pop_back();
+    }
+    else
+    {
+        job = IM_NEW(ImFontAtlasAsyncJob)();
+    }
+    job->Glyphs.swap(builder->AsyncGlyphsQueued);
+    builder->AsyncGlyphsQueued.resize(0);
+
+    // Allocate staging buffer on main thread
+    int pixels_size = 0;
+    for (ImFontAtlasAsyncGlyph& req : job->Glyphs)
+    {
+        req.PixelsOffset = pixels_size;
+        pixels_size += req.Width * req.Height * ImTextureDataGetFormatBytesPerPixel(req.Format);
+    }
+    job->Pixels.resize(pixels_size);
+    if (pixels_size > 0)
+        memset(job->Pixels.Data, 0, (size_t)pixels_size);
+    ImGui::GetAllocatorFunctions(&job->Allocator.AllocFunc, &job->Allocator.FreeFunc, &job->Allocator.UserData);
+
+    // Start job, or run it now
+    job->Ctx = ctx;
+    job->WaitFn = ctx ? ctx->PlatformIO.Platform_AsyncJobWaitFn : NULL;
+    job->Handle = ctx ? ctx->PlatformIO.Platform_AsyncJobStartFn(ctx, ImFontAtlasBuildRunAsyncJob, job) : NULL;
+    if (job->Handle == NULL)
+        ImFontAtlasBuildRunAsyncJob(job);
+    builder->AsyncJobs.push_back(job);
+}
+
+void ImFontAtlasBuildStartAsyncGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL || builder->AsyncGlyphsQueued.Size == 0)
+        return;
+    ImFontAtlasBuildStartAsyncJob(atlas, ImFontAtlasBuildGetAsyncContext(atlas));
+}
+
+// Copy bitmaps of completed jobs into atlas, in the order they were started.
+// - Glyphs whose baked or rectangle were discarded while rasterizing are ignored.
+// - With 'wait_all', also rasterize queued glyphs and wait for all jobs (e.g. before destroying font sources).
+void ImFontAtlasBuildCommitAsyncGlyphs(ImFontAtlas* atlas, bool wait_all)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL)
+        return;
+    if (wait_all && builder->AsyncGlyphsQueued.Size > 0)
+        ImFontAtlasBuildStartAsyncJob(atlas, NULL);
+
+    int jobs_committed = 0;
+    ImGuiID last_baked_id = 0;
+    for (ImFontAtlasAsyncJob* job : builder->AsyncJobs)
+    {
+        if (job->Handle != NULL)
+        {
+            if (!job->WaitFn(job->Ctx, job->Handle, wait_all))
+                break;
+            job->Handle = NULL;
+        }
+
+        for (ImFontAtlasAsyncGlyph& req : job->Glyphs)
+        {
+            ImFontBaked* baked = (ImFontBaked*)builder->BakedMap.GetVoidPtr(req.BakedId);
+            if (baked == NULL || baked->WantDestroy || req.GlyphIndex < 0 || req.GlyphIndex >= baked->Glyphs.Size)
+                continue;
+            ImFontGlyph* glyph = &baked->Glyphs[req.GlyphIndex];
+            if (glyph->PackId != req.PackId)
+                continue;
+
+            unsigned char* pixels = job->Pixels.Data + req.PixelsOffset;
+            if (!req.Rasterized)
+            {
+                // Worker failed (e.g. allocation failure): try again on main thread
+                memset(pixels, 0, (size_t)(req.Width * req.Height * ImTextureDataGetFormatBytesPerPixel(req.Format)));
+                req.Loader->FontBakedRasterizeGlyph(&req, pixels, NULL);
+            }
+            ImFontConfig* src = baked->OwnerFont->Sources[glyph->SourceIdx];
+            ImTextureRect* r = ImFontAtlasPackGetRect(atlas, req.PackId);
+            ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, glyph, r, pixels, req.Format, req.Width * ImTextureDataGetFormatBytesPerPixel(req.Format));
+            glyph->Visible = true;
+            builder->AsyncGlyphsCommitted++;
+
+            // Cached layouts skipped the glyph while it was invisible
+            if (req.BakedId != last_baked_id)
+                for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
+                    if (shared_data->TextLayoutCache)
+                        shared_data->TextLayoutCache->DiscardBaked(req.BakedId);
+            last_baked_id = req.BakedId;
+        }
+        job->Glyphs.resize(0);
+        jobs_committed++;
+    }
+
+    // Recycle jobs
+    if (jobs_committed == 0)
+        return;
+    for (int n = 0; n < jobs_committed; n++)
+        builder->AsyncJobsFree.push_back(builder->AsyncJobs[n]);
+    builder->AsyncJobs.erase(builder->AsyncJobs.Data, builder->AsyncJobs.Data + jobs_committed);
+}
+
 void ImFont::AddRemapChar(ImWchar from_codepoint, ImWchar to_codepoint)
 {
     RemapPairs.SetInt((ImGuiID)from_codepoint, (int)to_codepoint);
@@ -5530,6 +7988,27 @@ ImVec2 ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wra
             }
         }
 
+        // Fast path: sum widths over a run of printable ASCII characters, without decoding nor checking for control characters.
+        // Widths are accumulated in the same order as below, so results are identical.
+        if ((unsigned char)*s >= 0x20 && (unsigned char)*s < 0x80 && baked->IndexAdvanceX.Size >= 0x80)
+        {
+            const char* run_end = ImTextFindNonAscii(s, (word_wrap_enabled && word_wrap_eol < text_end_display) ? word_wrap_eol : text_end_display, 0x20);
+            while (s < run_end)
+            {
+                float char_width = baked->IndexAdvanceX.Data[(unsigned char)*s];
+                if (char_width < 0.0f)
+                    char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, (unsigned char)*s);
+                char_width *= scale;
+                if (line_width + char_width >= max_width)
+                    break;
+                line_width += char_width;
+                s++;
+            }
+            if (s < run_end)
+                break;
+            continue;
+        }
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
@@ -5585,6 +8064,323 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     return ImFontCalcTextSizeEx(this, size, max_width, wrap_width, text_begin, text_end, text_end, out_remaining, NULL, ImDrawTextFlags_None);
 }
 
+void ImTextLayoutCache::Clear()
+{
+    if (Layouts.Size == 0 && Buckets.Size == 0)
+        return;
+    for (ImTextLayout& layout : Layouts)
+    {
+        layout.Text.clear();
+        layout.Glyphs.clear();
+    }
+    Layouts.clear();
+    Buckets.clear();
+    FreeIndices.clear();
+    LayoutsActive = 0;
+}
+
+// Text is hashed with the fast hash used for draw lists contents: hashing a label needs to be much cheaper than measuring it.
+static ImU32 ImTextLayoutCalcHash(ImGuiID baked_id, float size, float wrap_width, const char* text, int text_len)
+{
+    ImU32 size_bits, wrap_width_bits;
+    memcpy(&size_bits, &size, 4);
+    memcpy(&wrap_width_bits, &wrap_width, 4);
+    return ImDrawListHashData(text, (size_t)text_len, baked_id ^ (size_bits * 0x85EBCA77u) ^ (wrap_width_bits * 0xC2B2AE3Du));
+}
+
+ImTextLayout* ImTextLayoutCache::GetLayout(ImFont* font, ImFontBaked* baked, float size, float wrap_width, const char* text, const char* text_end)
+{
+    const int text_len = (int)(text_end - text);
+    if (wrap_width < 0.0f)
+        wrap_width = 0.0f; // All values <= 0.0f disable wrapping
+    if (text_len > IM_TEXT_LAYOUT_CACHE_MAX_LENGTH || (text_len < IM_TEXT_LAYOUT_CACHE_MIN_LENGTH && wrap_width == 0.0f))
+        return NULL;
+    if ((LayoutsActive + 1) * 2 > Buckets.Size)
+        RebuildBuckets(ImMax(256, Buckets.Size * 2)); // Keep load factor <= 0.5, so probing sequences are short and always end on an empty slot.
+
+    const ImU32 hash = ImTextLayoutCalcHash(baked->BakedId, size, wrap_width, text, text_len);
+    const int buckets_mask = Buckets.Size - 1;
+    int bucket_n = (int)(hash & (ImU32)buckets_mask);
+    for (; Buckets.Data[bucket_n] != 0; bucket_n = (bucket_n + 1) & buckets_mask)
+    {
+        ImTextLayout* layout = &Layouts.Data[Buckets.Data[bucket_n] - 1];
+        if (layout->Hash != hash || layout->Text.Size != text_len || layout->Font != font || layout->BakedId != baked->BakedId || layout->Size != size || layout->WrapWidth != wrap_width)
+            continue;
+        if (memcmp(layout->Text.Data, text, (size_t)text_len) != 0)
+            continue;
+        layout->LastUsedFrame = FrameCount;
+        return layout;
+    }
+
+    // Add
+    int layout_idx;
+    if (FreeIndices.Size > 0)
+    {
+        layout_idx = FreeIndices.back();
+        FreeIndices.pop_back();
+    }
+    else
+    {
+        layout_idx = Layouts.Size;
+        Layouts.push_back(ImTextLayout());
+    }
+    ImTextLayout* layout = &Layouts[layout_idx];
+    layout->Hash = hash;
+    layout->LastUsedFrame = FrameCount;
+    layout->Font = font;
+    layout->BakedId = baked->BakedId;
+    layout->Size = size;
+    layout->WrapWidth = wrap_width;
+    layout->SizeValid = layout->GlyphsValid = false;
+    layout->Text.reserve(IM_MEMALIGN(text_len, 16)); // Round capacities so recycled entries rarely need to grow
+    layout->Text.resize(text_len);
+    memcpy(layout->Text.Data, text, (size_t)text_len);
+    layout->Glyphs.resize(0);
+    Buckets.Data[bucket_n] = layout_idx + 1;
+    LayoutsActive++;
+    return layout;
+}
+
+void ImTextLayoutCache::RebuildBuckets(int buckets_count)
+{
+    IM_ASSERT(ImIsPowerOfTwo(buckets_count) && buckets_count > LayoutsActive);
+    Buckets.resize(buckets_count);
+    memset(Buckets.Data, 0, (size_t)Buckets.size_in_bytes());
+    const int buckets_mask = buckets_count - 1;
+    for (int layout_n = 0; layout_n < Layouts.Size; layout_n++)
+    {
+        if (Layouts.Data[layout_n].Font == NULL)
+            continue;
+        int bucket_n = (int)(Layouts.Data[layout_n].Hash & (ImU32)buckets_mask);
+        while (Buckets.Data[bucket_n] != 0)
+            bucket_n = (bucket_n + 1) & buckets_mask;
+        Buckets.Data[bucket_n] = layout_n + 1;
+    }
+}
+
+// Free entries keep their buffers: texts which change every frame (e.g. a FPS counter) recycle them without allocating.
+static void ImTextLayoutCacheFree(ImTextLayoutCache* cache, int layout_idx)
+{
+    ImTextLayout* layout = &cache->Layouts[layout_idx];
+    layout->Font = NULL;
+    layout->Text.resize(0);
+    layout->Glyphs.resize(0);
+    cache->FreeIndices.push_back(layout_idx);
+    cache->LayoutsActive--;
+}
+
+// Called every few frames by NewFrame(). Unlike the hot lookup path, this is a linear scan.
+void ImTextLayoutCache::DiscardUnused(int unused_frames)
+{
+    const int layouts_active_prev = LayoutsActive;
+    for (int layout_n = 0; layout_n < Layouts.Size; layout_n++)
+        if (Layouts.Data[layout_n].Font != NULL && Layouts.Data[layout_n].LastUsedFrame + unused_frames < FrameCount)
+            ImTextLayoutCacheFree(this, layout_n);
+    if (LayoutsActive != layouts_active_prev)
+        RebuildBuckets(Buckets.Size); // Removing from an open addressing table would otherwise break probing sequences
+}
+
+// Called when a ImFontBaked is discarded or one of its glyph is reloaded: glyph indices in layouts are not valid anymore.
+void ImTextLayoutCache::DiscardBaked(ImGuiID baked_id)
+{
+    const int layouts_active_prev = LayoutsActive;
+    for (int layout_n = 0; layout_n < Layouts.Size; layout_n++)
+        if (Layouts.Data[layout_n].Font != NULL && Layouts.Data[layout_n].BakedId == baked_id)
+            ImTextLayoutCacheFree(this, layout_n);
+    if (LayoutsActive != layouts_active_prev)
+        RebuildBuckets(Buckets.Size);
+}
+
+// Fill layout->Glyphs[] with the same logic as ImFont::RenderText(), relative to a (0,0) origin and without clipping.
+static void ImFontBuildTextLayoutGlyphs(ImFont* font, ImFontBaked* baked, ImTextLayout* layout)
+{
+    const float size = layout->Size;
+    const float line_height = size;
+    const float scale = size / baked->Size;
+    const float wrap_width = layout->WrapWidth;
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+    const char* word_wrap_eol = NULL;
+    const char* s = layout->Text.begin();
+    const char* text_end = layout->Text.end();
+    float x = 0.0f;
+    float y = 0.0f;
+    layout->Glyphs.reserve(IM_MEMALIGN(layout->Text.Size, 16)); // At most one glyph per byte
+    layout->Glyphs.resize(0);
+    while (s < text_end)
+    {
+        if (word_wrap_enabled)
+        {
+            if (!word_wrap_eol)
+                word_wrap_eol = ImFontCalcWordWrapPositionEx(font, size, s, text_end, wrap_width - x);
+            if (s >= word_wrap_eol)
+            {
+                x = 0.0f;
+                y += line_height;
+                word_wrap_eol = NULL;
+                s = ImTextCalcWordWrapNextLineStart(s, text_end);
+                continue;
+            }
+        }
+
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                x = 0.0f;
+                y += line_height;
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+
+        const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)c); // May load glyph and grow Glyphs[]: store index.
+        if (glyph->Visible)
+        {
+            ImTextLayoutGlyph layout_glyph = { x, y, (int)(glyph - baked->Glyphs.Data) };
+            layout->Glyphs.push_back(layout_glyph);
+        }
+        x += glyph->AdvanceX * scale;
+    }
+    layout->GlyphsValid = true;
+}
+
+// Glyphs on another texture page than the main one (ImFontAtlasFlags_MultiPage) are deferred while rendering text,
+// then submitted after the other glyphs with one draw command per page.
+static inline void ImFontDeferPageQuad(ImDrawList* draw_list, const ImDrawVert* vtx, int page_idx)
+{
+    ImVector<ImFontPageQuad>& quads = draw_list->_Data->TextPageQuads;
+    quads.resize(quads.Size + 1);
+    ImFontPageQuad& quad = quads.back();
+    memcpy(quad.Vtx, vtx, sizeof(quad.Vtx));
+    quad.PageIndex = page_idx;
+}
+
+static void ImFontRenderPageQuads(ImDrawList* draw_list, ImFontAtlas* atlas)
+{
+    ImVector<ImFontPageQuad>& quads = draw_list->_Data->TextPageQuads;
+    ImU32 pages_mask = 0;
+    for (const ImFontPageQuad& quad : quads)
+        pages_mask |= 1u << quad.PageIndex;
+    for (int page_idx = 1; page_idx < IM_FONTATLAS_PAGES_MAX; page_idx++)
+    {
+        if ((pages_mask & (1u << page_idx)) == 0)
+            continue;
+        ImTextureData* tex = ImFontAtlasPageGetTexture(atlas, page_idx);
+        if (tex == NULL)
+            continue;
+        int quads_count = 0;
+        for (const ImFontPageQuad& quad : quads)
+            quads_count += (quad.PageIndex == page_idx);
+
+        draw_list->PushTexture(tex->GetTexRef());
+        draw_list->PrimReserve(quads_count * 6, quads_count * 4);
+        ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+        ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+        unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+        for (const ImFontPageQuad& quad : quads)
+            if (quad.PageIndex == page_idx)
+            {
+                memcpy(vtx_write, quad.Vtx, sizeof(quad.Vtx));
+                idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+                idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+                vtx_write += 4;
+                vtx_index += 4;
+                idx_write += 6;
+            }
+        draw_list->_VtxWritePtr = vtx_write;
+        draw_list->_IdxWritePtr = idx_write;
+        draw_list->_VtxCurrentIdx = vtx_index;
+        draw_list->PopTexture();
+    }
+    quads.resize(0);
+}
+
+// Render a cached layout at (x, y). Same output as the main loop in ImFont::RenderText().
+static void ImFontRenderTextLayout(ImDrawList* draw_list, ImFontBaked* baked, const ImTextLayout* layout, float x, float y, ImU32 col, const ImVec4& clip_rect, bool cpu_fine_clip)
+{
+    if (layout->Glyphs.Size == 0)
+        return;
+    const float line_height = layout->Size;
+    const float scale = layout->Size / baked->Size;
+
+    // Reserve for all visible glyphs, give back clipped ones at the end
+    const int vtx_count_max = layout->Glyphs.Size * 4;
+    const int idx_count_max = layout->Glyphs.Size * 6;
+    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+    ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+
+    for (const ImTextLayoutGlyph& layout_glyph : layout->Glyphs)
+    {
+        // Glyphs are sorted by line: skip lines above clip rectangle, stop after the last visible one.
+        const float line_y = y + layout_glyph.Y;
+        if (line_y + line_height < clip_rect.y)
+            continue;
+        if (line_y > clip_rect.w)
+            break;
+
+        IM_ASSERT(layout_glyph.GlyphIndex < baked->Glyphs.Size);
+        const ImFontGlyph* glyph = &baked->Glyphs.Data[layout_glyph.GlyphIndex];
+        const float glyph_x = x + layout_glyph.X;
+        float x1 = glyph_x + glyph->X0 * scale;
+        float x2 = glyph_x + glyph->X1 * scale;
+        float y1 = line_y + glyph->Y0 * scale;
+        float y2 = line_y + glyph->Y1 * scale;
+        if (x1 > clip_rect.z || x2 < clip_rect.x)
+            continue;
+        float u1 = glyph->U0;
+        float v1 = glyph->V0;
+        float u2 = glyph->U1;
+        float v2 = glyph->V1;
+
+        // CPU side clipping used to fit text in their frame when the frame is too small. Only does clipping for axis aligned quads.
+        if (cpu_fine_clip)
+        {
+            if (x1 < clip_rect.x) { u1 = u1 + (1.0f - (x2 - clip_rect.x) / (x2 - x1)) * (u2 - u1); x1 = clip_rect.x; }
+            if (y1 < clip_rect.y) { v1 = v1 + (1.0f - (y2 - clip_rect.y) / (y2 - y1)) * (v2 - v1); y1 = clip_rect.y; }
+            if (x2 > clip_rect.z) { u2 = u1 + ((clip_rect.z - x1) / (x2 - x1)) * (u2 - u1); x2 = clip_rect.z; }
+            if (y2 > clip_rect.w) { v2 = v1 + ((clip_rect.w - y1) / (y2 - y1)) * (v2 - v1); y2 = clip_rect.w; }
+            if (y1 >= y2)
+                continue;
+        }
+
+        // Support for untinted glyphs
+        ImU32 glyph_col = glyph->Colored ? col_untinted : col;
+        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
+        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
+        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
+        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+        if (glyph->PageIndex != 0)
+        {
+            ImFontDeferPageQuad(draw_list, vtx_write, glyph->PageIndex);
+            continue;
+        }
+        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+        vtx_write += 4;
+        vtx_index += 4;
+        idx_write += 6;
+    }
+
+    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data);
+    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
+    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_index;
+    if (draw_list->_Data->TextPageQuads.Size > 0)
+        ImFontRenderPageQuads(draw_list, baked->OwnerFont->OwnerAtlas);
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c, const ImVec4* cpu_fine_clip)
 {
@@ -5620,8 +8416,12 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         if (y1 >= y2)
             return;
     }
+    if (glyph->PageIndex != 0)
+        draw_list->PushTexture(ImFontAtlasPageGetTexture(OwnerAtlas, glyph->PageIndex)->GetTexRef()); // ImFontAtlasFlags_MultiPage
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
+    if (glyph->PageIndex != 0)
+        draw_list->PopTexture();
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
@@ -5645,6 +8445,17 @@ begin:
     const float origin_x = x;
     const bool word_wrap_enabled = (wrap_width > 0.0f);
 
+    // Use cached layout (io.ConfigTextLayoutCache). Glyphs are all loaded when building the layout, before we reserve vertices.
+    if (ImTextLayoutCache* layout_cache = draw_list->_Data->TextLayoutCache)
+        if ((flags & ~ImDrawTextFlags_CpuFineClip) == 0 && text_begin != text_end)
+            if (ImTextLayout* layout = layout_cache->GetLayout(this, baked, size, wrap_width, text_begin, text_end))
+            {
+                if (!layout->GlyphsValid)
+                    ImFontBuildTextLayoutGlyphs(this, baked, layout);
+                ImFontRenderTextLayout(draw_list, baked, layout, x, y, col, clip_rect, (flags & ImDrawTextFlags_CpuFineClip) != 0);
+                return;
+            }
+
     // Fast-forward to first visible line
     const char* s = text_begin;
     if (y + line_height < clip_rect.y)
@@ -5797,11 +8608,19 @@ begin:
                     vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
                     vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
                     vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
-                    idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
-                    idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
-                    vtx_write += 4;
-                    vtx_index += 4;
-                    idx_write += 6;
+                    if (glyph->PageIndex != 0)
+                    {
+                        // Glyph on another texture page (ImFontAtlasFlags_MultiPage): submitted after the loop
+                        ImFontDeferPageQuad(draw_list, vtx_write, glyph->PageIndex);
+                    }
+                    else
+                    {
+                        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+                        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+                        vtx_write += 4;
+                        vtx_index += 4;
+                        idx_write += 6;
+                    }
                 }
             }
         }
@@ -5815,6 +8634,7 @@ begin:
         draw_list->CmdBuffer.pop_back();
         draw_list->PrimUnreserve(idx_count_max, vtx_count_max);
         draw_list->AddDrawCmd();
+        draw_list->_Data->TextPageQuads.resize(0);
         //IMGUI_DEBUG_LOG("RenderText: cancel and retry to missing glyphs.\n"); // [DEBUG]
         //draw_list->AddRectFilled(pos, pos + ImVec2(10, 10), IM_COL32(255, 0, 0, 255)); // [DEBUG]
         goto begin;
@@ -5829,6 +8649,8 @@ begin:
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
     draw_list->_VtxCurrentIdx = vtx_index;
+    if (draw_list->_Data->TextPageQuads.Size > 0)
+        ImFontRenderPageQuads(draw_list, OwnerAtlas);
 }
 
 //-----------------------------------------------------------------------------
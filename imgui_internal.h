@@ -63,6 +63,9 @@ Index of this file:
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
 #if (defined __AVX__ || defined __SSE4_2__)
 #define IMGUI_ENABLE_SSE4_2
 #include <nmmintrin.h>
@@ -72,6 +75,11 @@ Index of this file:
 #if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(__EMSCRIPTEN__)
 #define IMGUI_ENABLE_SSE4_2_CRC
 #endif
+// Enable NEON intrinsics if available (AArch64 only, as we use horizontal reductions)
+#if (defined(__aarch64__) || defined(_M_ARM64)) && !defined(IMGUI_DISABLE_NEON)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -142,8 +150,10 @@ struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
 struct ImFontAtlasBuilder;          // Internal storage for incrementally packing and building a ImFontAtlas
+struct ImFontAtlasPage;             // Extra texture page (ImFontAtlasFlags_MultiPage)
 struct ImFontAtlasPostProcessData;  // Data available to potential texture post-processing functions
 struct ImFontAtlasRectEntry;        // Packed rectangle lookup entry
+struct ImTextLayoutCache;           // Opt-in cache of measured/laid out short texts (io.ConfigTextLayoutCache)
 
 // ImGui
 struct ImGuiBoxSelectState;         // Box-selection state (currently used by multi-selection, could potentially be used by others)
@@ -152,6 +162,7 @@ struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiContextHook;            // Hook for extensions like ImGuiTestEngine
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
 struct ImGuiDeactivatedItemData;    // Data for IsItemDeactivated()/IsItemDeactivatedAfterEdit() function.
+struct ImGuiDebugProfiler;          // Storage for Metrics->Profiler (per-frame CPU scopes timings)
 struct ImGuiErrorRecoveryState;     // Storage of stack sizes for error handling and recovery
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
@@ -251,6 +262,15 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #define IMGUI_DEBUG_LOG_FONT(...)       do { ImGuiContext* g2 = GImGui; if (g2 && g2->DebugLogFlags & ImGuiDebugLogFlags_EventFont) IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0) // Called from ImFontAtlas function which may operate without a context.
 #define IMGUI_DEBUG_LOG_INPUTROUTING(...) do{if (g.DebugLogFlags & ImGuiDebugLogFlags_EventInputRouting)IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
 
+// Debug Profiler for Metrics->Profiler. Scopes are only recorded when g.DebugProfiler.Active is set (latched in NewFrame() from g.DebugProfiler.Enabled).
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+#define IMGUI_DEBUG_PROFILER_SCOPE_BEGIN(_NAME,_TYPE,_ID)   do { if (g.DebugProfiler.Active) ImGui::DebugProfilerScopeBegin(_NAME, _TYPE, _ID); } while (0)
+#define IMGUI_DEBUG_PROFILER_SCOPE_END()                    do { if (g.DebugProfiler.Active) ImGui::DebugProfilerScopeEnd(); } while (0)
+#else
+#define IMGUI_DEBUG_PROFILER_SCOPE_BEGIN(_NAME,_TYPE,_ID)   ((void)0)
+#define IMGUI_DEBUG_PROFILER_SCOPE_END()                    ((void)0)
+#endif
+
 // Static Asserts
 #define IM_STATIC_ASSERT(_COND)         static_assert(_COND, "")
 
@@ -429,6 +449,7 @@ IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, cons
 IMGUI_API const char*   ImTextFindPreviousUtf8Codepoint(const char* in_text_start, const char* in_p);                           // return previous UTF-8 code-point.
 IMGUI_API const char*   ImTextFindValidUtf8CodepointEnd(const char* in_text_start, const char* in_text_end, const char* in_p);  // return previous UTF-8 code-point if 'in_p' is not the end of a valid one.
 IMGUI_API int           ImTextCountLines(const char* in_text, const char* in_text_end);                                         // return number of lines taken by text. trailing carriage return doesn't count as an extra line.
+IMGUI_API const char*   ImTextFindNonAscii(const char* in_text, const char* in_text_end, unsigned int min_c = 1);                // return first byte outside of [min_c..0x7F] (e.g. zero-terminator, start of a multi-byte UTF-8 sequence), or in_text_end. Scans 16-32 bytes at a time.
 
 // Helpers: High-level text functions (DO NOT USE!!! THIS IS A MINIMAL SUBSET OF LARGER UPCOMING CHANGES)
 enum ImDrawTextFlags_
@@ -846,6 +867,81 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList: Cache of tessellated curves for auto-tessellated PathBezierCubicCurveTo() and PathArcTo() with many segments.
+#ifndef IM_DRAWLIST_CURVE_CACHE_SIZE
+#define IM_DRAWLIST_CURVE_CACHE_SIZE                            256 // Number of cached curves.
+#endif
+#define IM_DRAWLIST_CURVE_CACHE_WAYS                            4   // Set associativity: a curve may only be stored in one of 4 entries, selected by its hash.
+
+// Tessellated curve, stored relative to its first point (bezier) or center (arc) so it can be reused when the same shape is drawn at another position.
+struct ImDrawListCurveCacheEntry
+{
+    ImU32               Hash;
+    ImU32               LastUse;        // Value of ImDrawListSharedData::CurveCacheTick when last used, for LRU eviction
+    float               Key[8];         // Curve type and parameters, compared bitwise
+    ImVector<ImVec2>    Points;         // Tessellated points. Empty when just allocated by CurveCacheGet().
+};
+
+// Text layout cache: texts outside of this range are always measured/rendered directly. Short ones are cheaper to measure than to look up, unless wrapped.
+#ifndef IM_TEXT_LAYOUT_CACHE_MIN_LENGTH
+#define IM_TEXT_LAYOUT_CACHE_MIN_LENGTH                         16
+#endif
+#ifndef IM_TEXT_LAYOUT_CACHE_MAX_LENGTH
+#define IM_TEXT_LAYOUT_CACHE_MAX_LENGTH                         256
+#endif
+#define IM_TEXT_LAYOUT_CACHE_UNUSED_FRAMES                      60  // Layouts unused for this many frames are discarded.
+
+// Visible glyph of a cached text layout
+struct ImTextLayoutGlyph
+{
+    float               X, Y;           // Pen position relative to text origin. Y is the top of the line.
+    int                 GlyphIndex;     // Index in ImFontBaked::Glyphs[]
+};
+
+// Cached layout of a short text for a given font, size and wrap width. Position independent.
+struct ImTextLayout
+{
+    ImU32               Hash;
+    int                 LastUsedFrame;
+    ImFont*             Font;           // NULL for free entries
+    ImGuiID             BakedId;        // ImFontBaked::BakedId. Layouts are discarded with their baked font, as glyph indices are only valid for it.
+    float               Size;
+    float               WrapWidth;
+    ImVec2              TextSize;       // Output of ImFontCalcTextSizeEx(), not rounded. Valid if SizeValid.
+    bool                SizeValid;
+    bool                GlyphsValid;
+    ImVector<char>      Text;
+    ImVector<ImTextLayoutGlyph> Glyphs; // Visible glyphs, in rendering order. Valid if GlyphsValid.
+};
+
+// Opt-in cache of text layouts, enabled with io.ConfigTextLayoutCache.
+// Labels which are measured and drawn every frame skip UTF-8 decoding, glyph lookups and word-wrapping.
+// Keyed by text contents so it works with temporary buffers (e.g. ImGui::Text() formatting). Lookup cost is about that of measuring a dozen ASCII characters.
+struct IMGUI_API ImTextLayoutCache
+{
+    ImVector<ImTextLayout> Layouts;
+    ImVector<int>       Buckets;        // Open addressing hash table (linear probing). Index into Layouts[] + 1, 0 for empty slots.
+    ImVector<int>       FreeIndices;    // Free entries in Layouts[]
+    int                 LayoutsActive;
+    int                 FrameCount;
+
+    ImTextLayoutCache()                 { LayoutsActive = FrameCount = 0; }
+    ~ImTextLayoutCache()                { Clear(); }
+    void                Clear();
+    ImTextLayout*       GetLayout(ImFont* font, ImFontBaked* baked, float size, float wrap_width, const char* text, const char* text_end); // Return NULL if text is too long. New layouts have SizeValid == GlyphsValid == false.
+    void                DiscardUnused(int unused_frames);
+    void                DiscardBaked(ImGuiID baked_id);
+    void                RebuildBuckets(int buckets_count);
+};
+
+// Glyph quad using another texture page than the main atlas texture (ImFontAtlasFlags_MultiPage).
+// ImFont::RenderText() defers those and submits them after other glyphs, with one draw command per page.
+struct ImFontPageQuad
+{
+    ImDrawVert          Vtx[4];
+    int                 PageIndex;
+};
+
 // Data shared between all ImDrawList instances
 // Conceptually this could have been called e.g. ImDrawListSharedContext
 // Typically one ImGui context would create and maintain one of this.
@@ -853,7 +949,8 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 struct IMGUI_API ImDrawListSharedData
 {
     ImVec2          TexUvWhitePixel;            // UV of white pixel in the atlas (== FontAtlas->TexUvWhitePixel)
-    const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas (== FontAtlas->TexUvLines)
+    const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas (== FontAtlas->TexUvLines, or TexUvLinesCopy)
+    const ImVec4*   TexUvCorners;               // UV of anti-aliased rounded corners in the atlas (== FontAtlas->TexUvCorners, or TexUvCornersCopy)
     ImFontAtlas*    FontAtlas;                  // Current font atlas
     ImFont*         Font;                       // Current font (used for simplified AddText overload)
     float           FontSize;                   // Current font size (used for for simplified AddText overload)
@@ -863,24 +960,46 @@ struct IMGUI_API ImDrawListSharedData
     float           InitialFringeScale;         // Initial scale to apply to AA fringe
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
+    ImTextureRef    FontTexRef;                 // Font atlas texture, copied by UpdateDrawListSharedData() for ResetWorkerDrawList()
+    ImVec4          TexUvLinesCopy[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];      // Storage for TexUvLines, copied by UpdateDrawListSharedData(): the atlas may be repacked while jobs are running
+    ImVec4          TexUvCornersCopy[IM_DRAWLIST_TEX_CORNERS_RADIUS_MAX + 1]; // Storage for TexUvCorners, copied by UpdateDrawListSharedData()
     ImVector<ImVec2> TempBuffer;                // Temporary write buffer
     ImVector<ImDrawList*> DrawLists;            // All draw lists associated to this ImDrawListSharedData
     ImGuiContext*   Context;                    // [OPTIONAL] Link to Dear ImGui context. 99% of ImDrawList/ImFontAtlas can function without an ImGui context, but this facilitate handling one legacy edge case.
+    ImTextLayoutCache* TextLayoutCache;         // [OPTIONAL] Used by ImFont::RenderText() when set. == &Context->TextLayoutCache when io.ConfigTextLayoutCache is enabled.
+    ImVector<ImFontPageQuad> TextPageQuads;     // Temporary buffer for ImFont::RenderText(): glyphs on another texture page (ImFontAtlasFlags_MultiPage), submitted last.
 
     // Lookup tables
     ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
     float           ArcFastRadiusCutoff;                        // Cutoff radius after which arc drawing will fallback to slower PathArcTo()
     ImU8            CircleSegmentCounts[64];    // Precomputed segment count for given radius before we calculate it dynamically (to avoid calculation overhead)
 
+    // Tessellation cache (node editor wires, gauges etc. are often redrawn identically every frame, possibly at another position)
+    ImDrawListCurveCacheEntry CurveCache[IM_DRAWLIST_CURVE_CACHE_SIZE]; // Set-associative LRU cache, see CurveCacheGet()
+    ImU32           CurveCacheTick;             // Incremented on every lookup
+
     ImDrawListSharedData();
     ~ImDrawListSharedData();
     void SetCircleTessellationMaxError(float max_error);
+    ImDrawListCurveCacheEntry* CurveCacheGet(const float key[8]); // Return matching entry, or recycle least recently used entry of the set with empty Points[] for the caller to fill.
+};
+
+// Extend ImDrawListFlags_
+enum ImDrawListFlagsPrivate_
+{
+    ImDrawListFlags_IdxPacked16             = 1 << 10, // IdxBuffer[] contents were packed to 16-bit indices by ImDrawData::PackIndexBuffers(). Cleared by _ResetForNewFrame().
 };
 
+// Read an index from a draw list, honoring indices packed by ImDrawData::PackIndexBuffers()
+inline unsigned int ImDrawListGetIdx(const ImDrawList* draw_list, int idx_n) { return (draw_list->Flags & ImDrawListFlags_IdxPacked16) ? ((const ImU16*)(const void*)draw_list->IdxBuffer.Data)[idx_n] : draw_list->IdxBuffer.Data[idx_n]; }
+
 struct ImDrawDataBuilder
 {
     ImVector<ImDrawList*>*  Layers[2];      // Pointers to global layers for: regular, tooltip. LayersP[0] is owned by DrawData.
     ImVector<ImDrawList*>   LayerData1;
+    ImVector<ImDrawList*>   MergedLists;    // Owned draw lists, output of io.ConfigRenderMergeDrawLists. Reused every frame.
+    int                     MergeStatsListsIn, MergeStatsListsOut; // [DEBUG] Draw lists count before/after merging, for Metrics
+    int                     MergeStatsCmdsIn, MergeStatsCmdsOut;   // [DEBUG] Draw commands count before/after merging, for Metrics
 
     ImDrawDataBuilder()                     { memset(this, 0, sizeof(*this)); }
 };
@@ -1953,6 +2072,8 @@ struct ImGuiViewportP : public ImGuiViewport
     ImDrawList*         BgFgDrawLists[2];       // Convenience background (0) and foreground (1) draw lists. We use them to draw software mouser cursor when io.MouseDrawCursor is set and to draw most debug overlays.
     ImDrawData          DrawDataP;
     ImDrawDataBuilder   DrawDataBuilder;        // Temporary data while building final ImDrawData
+    ImU32               DrawDataLastContentHash;        // DrawDataP.ContentHash of last frame which computed it (io.ConfigRenderDetectUnchangedFrames)
+    int                 DrawDataLastContentHashFrame;   // Frame number of DrawDataLastContentHash
 
     // Per-viewport work area
     // - Insets are >= 0.0f values, distance from viewport corners to work area.
@@ -1963,8 +2084,8 @@ struct ImGuiViewportP : public ImGuiViewport
     ImVec2              BuildWorkInsetMin;      // Work Area inset accumulator for current frame, to become next frame's WorkInset
     ImVec2              BuildWorkInsetMax;      // "
 
-    ImGuiViewportP()    { BgFgDrawListsLastFrame[0] = BgFgDrawListsLastFrame[1] = -1; BgFgDrawLists[0] = BgFgDrawLists[1] = NULL; }
-    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); }
+    ImGuiViewportP()    { BgFgDrawListsLastFrame[0] = BgFgDrawListsLastFrame[1] = -1; BgFgDrawLists[0] = BgFgDrawLists[1] = NULL; DrawDataLastContentHash = 0; DrawDataLastContentHashFrame = -1; }
+    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); for (ImDrawList* draw_list : DrawDataBuilder.MergedLists) IM_DELETE(draw_list); }
 
     // Calculate work rect pos/size given a set of offset (we have 1 pair of offset for rect locked from last frame data, and 1 pair for currently building rect)
     ImVec2  CalcWorkRectPos(const ImVec2& inset_min) const                           { return ImVec2(Pos.x + inset_min.x, Pos.y + inset_min.y); }
@@ -2089,14 +2210,87 @@ struct ImGuiDebugAllocEntry
     ImS16       FreeCount;
 };
 
+// A stable UI is expected to stop allocating after a few frames: buffers are kept and reused from frame to frame.
+// Use DebugAllocSteadyStateBegin() once warmed up to count (or assert on) any allocation happening after that.
 struct ImGuiDebugAllocInfo
 {
     int         TotalAllocCount;            // Number of call to MemAlloc().
     int         TotalFreeCount;
     ImS16       LastEntriesIdx;             // Current index in buffer
     ImGuiDebugAllocEntry LastEntriesBuf[6]; // Track last 6 frames that had allocations
+    int         SteadyStateStartFrame;      // Allocations from this frame onward are counted as steady state allocations. -1 when not tracking.
+    int         SteadyStateAllocCount;      // Number of calls to MemAlloc() since SteadyStateStartFrame.
+    size_t      SteadyStateAllocBytes;
+    int         SteadyStateLastAllocFrame;
+    bool        SteadyStateAssert;          // Assert on steady state allocation, to break in the culprit.
+    const void* OwnerThreadTag;             // Only record allocations from this thread (the one which created the context or last called NewFrame()). Others may be filling draw lists.
+
+    ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); SteadyStateStartFrame = SteadyStateLastAllocFrame = -1; }
+};
 
-    ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); }
+// [DEBUG] Lightweight CPU profiler, see Metrics->Profiler.
+// - Scopes are recorded per frame from NewFrame() to Render(): internal phases, windows (Begin/End), tables (BeginTable/EndTable) and user scopes.
+// - Storage is a ring buffer of the last IMGUI_DEBUG_PROFILER_HISTORY frames. Buffers are reused so steady state recording doesn't allocate.
+// - Timestamps are obtained from platform_io.Platform_GetTimeNsFn.
+#define IMGUI_DEBUG_PROFILER_HISTORY    120
+
+enum ImGuiDebugProfilerScopeType
+{
+    ImGuiDebugProfilerScopeType_Phase,      // Internal phase of NewFrame(), EndFrame(), Render()
+    ImGuiDebugProfilerScopeType_Window,     // Begin()/End()
+    ImGuiDebugProfilerScopeType_Table,      // BeginTable()/EndTable()
+    ImGuiDebugProfilerScopeType_User,       // DebugProfilerScopeBegin()/DebugProfilerScopeEnd() called by user code
+    ImGuiDebugProfilerScopeType_COUNT
+};
+
+struct ImGuiDebugProfilerScope
+{
+    ImU64                   TimeBegin;                  // In nanoseconds
+    ImU64                   TimeEnd;
+    ImGuiID                 ID;                         // Window or table ID, 0 for phases and user scopes.
+    int                     NameOffset;                 // Offset into owner frame's NamesBuf[]
+    ImS16                   Depth;
+    ImU8                    Type;                       // ImGuiDebugProfilerScopeType
+};
+
+struct ImGuiDebugProfilerFrame
+{
+    int                     FrameCount;
+    ImU64                   TimeBegin;
+    ImU64                   TimeEnd;
+    ImVector<ImGuiDebugProfilerScope> Scopes;           // In Begin order. Parent scopes always precede their children.
+    ImVector<char>          NamesBuf;                   // Zero-terminated copies of scope names (window names may be freed, table names are transient)
+
+    ImGuiDebugProfilerFrame() { FrameCount = -1; TimeBegin = TimeEnd = 0; }
+    const char*             GetScopeName(const ImGuiDebugProfilerScope* scope) const { return NamesBuf.Data + scope->NameOffset; }
+};
+
+// Metrics: aggregated timings of scopes sharing the same type/ID/name
+struct ImGuiDebugProfilerAggregate
+{
+    int                     ScopeIdx;                   // First scope with this key, for name/type/id
+    int                     Count;
+    ImU64                   TimeTotal;
+    ImU64                   TimeSelf;                   // TimeTotal minus time of child scopes
+};
+
+struct ImGuiDebugProfiler
+{
+    bool                    Enabled;                    // Set to enable recording, applied on next NewFrame().
+    bool                    Active;                     // Recording current frame (latched in NewFrame(), reset in Render())
+    int                     FrameIdx;                   // Frame being recorded (or last recorded) in Frames[]
+    int                     FramesCount;                // Number of recorded frames in Frames[]
+    int                     DisplayFrameOffset;         // Metrics: 0 = most recent frame, 1 = previous frame, etc.
+    ImVector<int>           ScopeStack;                 // Index of currently open scopes in Frames[FrameIdx].Scopes[]
+    ImGuiDebugProfilerScope*HookScope;                  // Scope being notified during ImGuiContextHookType_DebugProfilerScopeBegin/End hooks.
+    ImGuiDebugProfilerFrame Frames[IMGUI_DEBUG_PROFILER_HISTORY];
+    ImVector<ImGuiDebugProfilerAggregate> MetricsAggregates;    // [Internal] Metrics: scratch buffers for DebugNodeProfiler()
+    ImGuiStorage            MetricsAggregatesMap;
+    ImVector<int>           MetricsParentStack;
+
+    ImGuiDebugProfiler()    { Enabled = Active = false; FrameIdx = FramesCount = DisplayFrameOffset = 0; HookScope = NULL; }
+    int                     GetCompletedFramesCount() const { return Active ? ImMin(FramesCount, IMGUI_DEBUG_PROFILER_HISTORY - 1) : FramesCount; }
+    const ImGuiDebugProfilerFrame* GetCompletedFrame(int n) const { IM_ASSERT(n >= 0 && n < GetCompletedFramesCount()); return &Frames[(FrameIdx - n - (Active ? 1 : 0) + IMGUI_DEBUG_PROFILER_HISTORY) % IMGUI_DEBUG_PROFILER_HISTORY]; } // n = 0: most recent
 };
 
 struct ImGuiMetricsConfig
@@ -2157,7 +2351,7 @@ struct ImGuiIDStackTool
 //-----------------------------------------------------------------------------
 
 typedef void (*ImGuiContextHookCallback)(ImGuiContext* ctx, ImGuiContextHook* hook);
-enum ImGuiContextHookType { ImGuiContextHookType_NewFramePre, ImGuiContextHookType_NewFramePost, ImGuiContextHookType_EndFramePre, ImGuiContextHookType_EndFramePost, ImGuiContextHookType_RenderPre, ImGuiContextHookType_RenderPost, ImGuiContextHookType_Shutdown, ImGuiContextHookType_PendingRemoval_ };
+enum ImGuiContextHookType { ImGuiContextHookType_NewFramePre, ImGuiContextHookType_NewFramePost, ImGuiContextHookType_EndFramePre, ImGuiContextHookType_EndFramePost, ImGuiContextHookType_RenderPre, ImGuiContextHookType_RenderPost, ImGuiContextHookType_Shutdown, ImGuiContextHookType_DebugProfilerScopeBegin, ImGuiContextHookType_DebugProfilerScopeEnd, ImGuiContextHookType_PendingRemoval_ };
 
 struct ImGuiContextHook
 {
@@ -2197,6 +2391,7 @@ struct ImGuiContext
     float                   FontRasterizerDensity;              // Current font density. Used by all calls to GetFontBaked().
     float                   CurrentDpiScale;                    // Current window/viewport DpiScale == CurrentViewport->DpiScale
     ImDrawListSharedData    DrawListSharedData;
+    ImTextLayoutCache       TextLayoutCache;                    // Used when io.ConfigTextLayoutCache is enabled
     ImGuiID                 WithinEndChildID;                   // Set within EndChild()
     void*                   TestEngine;                         // Test engine user data
 
@@ -2408,7 +2603,7 @@ struct ImGuiContext
     ImVector<ImGuiTableTempData>    TablesTempData;             // Temporary table data (buffers reused/shared across instances, support nesting)
     ImPool<ImGuiTable>              Tables;                     // Persistent table data
     ImVector<float>                 TablesLastTimeActive;       // Last used timestamp of each tables (SOA, for efficient GC)
-    ImVector<ImDrawChannel>         DrawChannelsTempMergeBuffer;
+    ImVector<int>                   DrawChannelsTempMergeOrder; // Order of table draw channels passed to ImDrawListSplitter::Merge()
 
     // Tab bars
     ImGuiTabBar*                    CurrentTabBar;
@@ -2538,6 +2733,7 @@ struct ImGuiContext
     ImGuiDebugItemPathQuery DebugItemPathQuery;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+    ImGuiDebugProfiler      DebugProfiler;
 #if defined(IMGUI_DEBUG_HIGHLIGHT_ALL_ID_CONFLICTS) && !defined(IMGUI_DISABLE_DEBUG_TOOLS)
     ImGuiStorage            DebugDrawIdConflictsAliveCount;
     ImGuiStorage            DebugDrawIdConflictsHighlightSet;
@@ -2551,6 +2747,7 @@ struct ImGuiContext
     int                     WantCaptureMouseNextFrame;          // Explicit capture override via SetNextFrameWantCaptureMouse()/SetNextFrameWantCaptureKeyboard(). Default to -1.
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;             // Copied in EndFrame() from g.PlatformImeData.WantTextInput. Needs to be set for some backends (SDL3) to emit character inputs.
+    double                  NextFrameDeadline;                  // Earliest time requested via RequestNextFrame() during the frame. Copied to io.NextFrameDeadline by EndFrame(), along with requests from global state.
     ImVector<char>          TempBuffer;                         // Temporary text buffer
     char                    TempKeychordName[64];
 
@@ -2712,6 +2909,7 @@ struct IMGUI_API ImGuiWindow
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
+    ImVector<ImDrawList*>   DrawListsExtra;                     // Draw lists submitted with AddWindowDrawList(), rendered right after DrawList. Cleared on the first Begin() of each frame.
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup _or_ docked window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            ParentWindowInBeginStack;
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window. Doesn't cross through popups/dock nodes.
@@ -3189,6 +3387,7 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetBackgroundDrawList(ImGuiViewport* viewport);                     // get background draw list for the given viewport. this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList(ImGuiViewport* viewport);                     // get foreground draw list for the given viewport. this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API void          AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
+    IMGUI_API void          ParallelFor(int count, int work_size, void (*func)(void* func_data, int index), void* func_data); // Call func(func_data, n) for n in [0, count) via platform_io.Platform_ParallelForFn. 'work_size' = total amount of elements processed, small loops run serially.
 
     // Init
     IMGUI_API void          Initialize();
@@ -3686,6 +3885,8 @@ namespace ImGui
 
     // Debug Tools
     IMGUI_API void          DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size); // size >= 0 : alloc, size = -1 : free
+    IMGUI_API void          DebugAllocSteadyStateBegin(bool assert_on_alloc = false); // Count allocations from next frame onward in g.DebugAllocInfo.SteadyStateXXX (e.g. after warming up a UI which doesn't change).
+    IMGUI_API void          DebugAllocSteadyStateEnd();
     IMGUI_API void          DebugDrawCursorPos(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawLineExtents(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawItemRect(ImU32 col = IM_COL32(255, 0, 0, 255));
@@ -3698,6 +3899,11 @@ namespace ImGui
     IMGUI_API void          DebugBreakButtonTooltip(bool keyboard_only, const char* description_of_location);
     IMGUI_API void          ShowFontAtlas(ImFontAtlas* atlas);
     IMGUI_API void          DebugHookIdInfo(ImGuiID id, ImGuiDataType data_type, const void* data_id, const void* data_id_end);
+    IMGUI_API void          DebugProfilerFrameBegin();
+    IMGUI_API void          DebugProfilerFrameEnd();
+    IMGUI_API void          DebugProfilerScopeBegin(const char* name, ImGuiDebugProfilerScopeType type = ImGuiDebugProfilerScopeType_User, ImGuiID id = 0);
+    IMGUI_API void          DebugProfilerScopeEnd();
+    IMGUI_API void          DebugProfilerExportChromeTrace(ImGuiTextBuffer* out_buf);    // Export recorded frames in Chrome Trace Event format (load in chrome://tracing or https://ui.perfetto.dev)
     IMGUI_API void          DebugNodeColumns(ImGuiOldColumns* columns);
     IMGUI_API void          DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, const ImDrawList* draw_list, const char* label);
     IMGUI_API void          DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, const ImDrawList* draw_list, const ImDrawCmd* draw_cmd, bool show_mesh, bool show_aabb);
@@ -3712,6 +3918,7 @@ namespace ImGui
     IMGUI_API void          DebugNodeInputTextState(ImGuiInputTextState* state);
     IMGUI_API void          DebugNodeTypingSelectState(ImGuiTypingSelectState* state);
     IMGUI_API void          DebugNodeMultiSelectState(ImGuiMultiSelectState* state);
+    IMGUI_API void          DebugNodeProfiler(ImGuiDebugProfiler* profiler);
     IMGUI_API void          DebugNodeWindow(ImGuiWindow* window, const char* label);
     IMGUI_API void          DebugNodeWindowSettings(ImGuiWindowSettings* settings);
     IMGUI_API void          DebugNodeWindowsList(ImVector<ImGuiWindow*>* windows, const char* label);
@@ -3741,6 +3948,45 @@ namespace ImGui
 // [SECTION] ImFontLoader
 //-----------------------------------------------------------------------------
 
+// Allocator captured on the main thread, for font loaders rasterizing from a worker thread (ImFontAtlasFlags_AsyncGlyphLoad).
+// IM_ALLOC() can't be used there as it updates debug counters of the current context.
+struct ImFontAtlasAsyncAllocator
+{
+    ImGuiMemAllocFunc       AllocFunc;
+    ImGuiMemFreeFunc        FreeFunc;
+    void*                   UserData;
+};
+
+// A glyph bitmap waiting to be rasterized by a worker thread (ImFontAtlasFlags_AsyncGlyphLoad).
+// Created by ImFontAtlasBakedQueueFontGlyphBitmap() from ImFontLoader::FontBakedLoadGlyph(), after the glyph rectangle was packed and its metrics computed.
+// The glyph stays invisible until the bitmap is committed to the atlas at the beginning of a following frame.
+struct ImFontAtlasAsyncGlyph
+{
+    ImGuiID                 BakedId;            // Baked may be discarded and its glyph rectangle reused while rasterizing: validated on commit.
+    int                     GlyphIndex;         // Index in baked->Glyphs[], set by ImFontAtlasBakedAddFontGlyph()
+    ImFontAtlasRectId       PackId;
+    int                     Width, Height;      // Bitmap size (same as packed rectangle)
+    ImTextureFormat         Format;
+    int                     PixelsOffset;       // Offset in ImFontAtlasAsyncJob::Pixels[]
+    bool                    Rasterized;         // Set by worker on success. Failures are rasterized again on main thread when committing.
+    const ImFontLoader*     Loader;
+    void*                   LoaderFontSrcData;  // Parameters for ImFontLoader::FontBakedRasterizeGlyph(), copied by value as baked and glyph may move in memory.
+    int                     LoaderGlyphIndex;
+    float                   LoaderScaleX, LoaderScaleY;
+    int                     LoaderOversampleH, LoaderOversampleV;
+};
+
+// A batch of glyphs rasterized by one job. One job is started per frame, at the end of the frame.
+struct ImFontAtlasAsyncJob
+{
+    ImVector<ImFontAtlasAsyncGlyph> Glyphs;
+    ImVector<unsigned char>         Pixels;     // Staging buffer for all glyphs, allocated on main thread
+    ImFontAtlasAsyncAllocator       Allocator;
+    ImGuiContext*                   Ctx;        // Context whose platform_io.Platform_AsyncJobStartFn() started the job
+    bool                            (*WaitFn)(ImGuiContext* ctx, void* job_handle, bool blocking); // Copy of its platform_io.Platform_AsyncJobWaitFn
+    void*                           Handle;     // Returned by Platform_AsyncJobStartFn()
+};
+
 // Hooks and storage for a given font backend.
 // This structure is likely to evolve as we add support for incremental atlas updates.
 // Conceptually this could be public, but API is still going to be evolve.
@@ -3756,6 +4002,10 @@ struct ImFontLoader
     void            (*FontBakedDestroy)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
     bool            (*FontBakedLoadGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x);
 
+    // [Optional] Support for ImFontAtlasFlags_AsyncGlyphLoad: FontBakedLoadGlyph() calls ImFontAtlasBakedQueueFontGlyphBitmap() instead of ImFontAtlasBakedSetFontGlyphBitmap() when ImFontAtlasBuildIsAsyncGlyphLoad() returns true.
+    // FontBakedRasterizeGlyph() is then called from a worker thread (or main thread with allocator == NULL). It may only read 'glyph' and its LoaderFontSrcData, and write to 'out_pixels' (zero-cleared, pitch == glyph->Width).
+    bool            (*FontBakedRasterizeGlyph)(const ImFontAtlasAsyncGlyph* glyph, unsigned char* out_pixels, ImFontAtlasAsyncAllocator* allocator);
+
     // Size of backend data, Per Baked * Per Source. Buffers are managed by core to avoid excessive allocations.
     // FIXME: At this point the two other types of buffers may be managed by core to be consistent?
     size_t          FontBakedSrcLoaderDataSize;
@@ -3800,6 +4050,7 @@ struct ImFontAtlasRectEntry
     int                 TargetIndex : 20;   // When Used: ImFontAtlasRectId -> into Rects[]. When unused: index to next unused RectsIndex[] slot to consume free-list.
     unsigned int        Generation : 10;    // Increased each time the entry is reused for a new rectangle.
     unsigned int        IsUsed : 1;
+    unsigned int        PageIndex : 5;      // Texture page (ImFontAtlasFlags_MultiPage). 0 == atlas->TexData.
 };
 
 // Data available to potential texture post-processing functions
@@ -3829,6 +4080,20 @@ typedef stbrp_node stbrp_node_im;
 #endif
 struct stbrp_context_opaque { char data[80]; };
 
+// Extra texture page (ImFontAtlasFlags_MultiPage)
+// Once atlas->TexData reached TexPageSize, glyphs are packed into fixed-size pages which are never resized nor repacked.
+// A page is released when its last rectangle is discarded, and its slot reused by the next page.
+#define IM_FONTATLAS_PAGES_MAX              32              // Including main texture. Limited by ImFontGlyph::PageIndex bits.
+struct ImFontAtlasPage
+{
+    ImTextureData*              Tex;                    // NULL when released
+    stbrp_context_opaque        PackContext;            // Actually 'stbrp_context' but we don't want to define this in the header file.
+    ImVector<stbrp_node_im>     PackNodes;
+    int                         RectsCount;             // Number of rectangles in use
+
+    ImFontAtlasPage()           { memset(this, 0, sizeof(*this)); }
+};
+
 // Internal storage for incrementally packing and building a ImFontAtlas
 struct ImFontAtlasBuilder
 {
@@ -3856,8 +4121,18 @@ struct ImFontAtlasBuilder
     // Custom rectangle identifiers
     ImFontAtlasRectId           PackIdMouseCursors;     // White pixel + mouse cursors. Also happen to be fallback in case of packing failure.
     ImFontAtlasRectId           PackIdLinesTexData;
+    ImFontAtlasRectId           PackIdCornersTexData;
+
+    // Asynchronous glyph rasterization (ImFontAtlasFlags_AsyncGlyphLoad)
+    ImVector<ImFontAtlasAsyncGlyph> AsyncGlyphsQueued;  // Queued during current frame, started as one job at the end of the frame
+    ImVector<ImFontAtlasAsyncJob*>  AsyncJobs;          // Running jobs, oldest first
+    ImVector<ImFontAtlasAsyncJob*>  AsyncJobsFree;      // Recycled jobs, keeping their buffers
+    int                         AsyncGlyphsCommitted;   // Total number of glyphs committed, for Metrics/Debugger
 
-    ImFontAtlasBuilder()        { memset(this, 0, sizeof(*this)); FrameCount = -1; RectsIndexFreeListStart = -1; PackIdMouseCursors = PackIdLinesTexData = -1; }
+    // Extra texture pages (ImFontAtlasFlags_MultiPage). PageIndex N is stored in Pages[N - 1].
+    ImVector<ImFontAtlasPage*>  Pages;
+
+    ImFontAtlasBuilder()        { memset(this, 0, sizeof(*this)); FrameCount = -1; RectsIndexFreeListStart = -1; PackIdMouseCursors = PackIdLinesTexData = PackIdCornersTexData = -1; }
 };
 
 IMGUI_API void              ImFontAtlasBuildInit(ImFontAtlas* atlas);
@@ -3897,12 +4172,21 @@ IMGUI_API ImFontGlyph*      ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImF
 IMGUI_API void              ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImWchar codepoint, float advance_x);
 IMGUI_API void              ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, ImFontGlyph* glyph);
 IMGUI_API void              ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch);
+IMGUI_API ImFontAtlasAsyncGlyph* ImFontAtlasBakedQueueFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureFormat fmt);
+
+IMGUI_API bool              ImFontAtlasBuildIsAsyncGlyphLoad(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasBuildStartAsyncGlyphs(ImFontAtlas* atlas);   // Start a job for glyphs queued during the frame. Called by EndFrame().
+IMGUI_API void              ImFontAtlasBuildCommitAsyncGlyphs(ImFontAtlas* atlas, bool wait_all); // Commit bitmaps of completed jobs. With 'wait_all', also wait for running jobs and rasterize queued glyphs on calling thread.
 
 IMGUI_API void              ImFontAtlasPackInit(ImFontAtlas* atlas);
 IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry = NULL);
+IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddGlyphRect(ImFontAtlas* atlas, int w, int h); // May use another texture page with ImFontAtlasFlags_MultiPage: access pixels with ImFontAtlasPackGetTexture().
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API void              ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
+IMGUI_API ImTextureData*    ImFontAtlasPackGetTexture(ImFontAtlas* atlas, ImFontAtlasRectId id);
+IMGUI_API ImTextureData*    ImFontAtlasPageGetTexture(ImFontAtlas* atlas, int page_idx);
+IMGUI_API bool              ImFontAtlasBuildIsMultiPage(ImFontAtlas* atlas);
 
 IMGUI_API void              ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures);
 IMGUI_API void              ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data);
@@ -349,6 +349,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
     // [DEBUG] Debug break requested by user
     if (g.DebugBreakInTable == id)
         IM_DEBUG_BREAK();
+    IMGUI_DEBUG_PROFILER_SCOPE_BEGIN(name ? name : "Table", ImGuiDebugProfilerScopeType_Table, id);
 
     // Acquire storage for the table
     ImGuiTable* table = g.Tables.GetOrAddByKey(id);
@@ -1181,6 +1182,8 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         {
             column->AutoFitQueue >>= 1;
             column->CannotSkipItemsQueue >>= 1;
+            if (column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0)
+                RequestNextFrame();
         }
 
         if (visible_n < table->FreezeColumnsCount)
@@ -1431,9 +1434,10 @@ void    ImGui::EndTable()
     // Flatten channels and merge draw calls
     ImDrawListSplitter* splitter = table->DrawSplitter;
     splitter->SetCurrentChannel(inner_window->DrawList, 0);
+    g.DrawChannelsTempMergeOrder.resize(0);
     if ((table->Flags & ImGuiTableFlags_NoClip) == 0)
         TableMergeDrawChannels(table);
-    splitter->Merge(inner_window->DrawList);
+    splitter->Merge(inner_window->DrawList, g.DrawChannelsTempMergeOrder.Size > 0 ? g.DrawChannelsTempMergeOrder.Data : NULL);
 
     // Update ColumnsAutoFitWidth to get us ahead for host using our size to auto-resize without waiting for next BeginTable()
     float auto_fit_width_for_fixed = 0.0f;
@@ -1568,6 +1572,7 @@ void    ImGui::EndTable()
     }
     outer_window->DC.CurrentTableIdx = g.CurrentTable ? g.Tables.GetIndex(g.CurrentTable) : -1;
     NavUpdateCurrentWindowIsScrollPushableX();
+    IMGUI_DEBUG_PROFILER_SCOPE_END();
 }
 
 // Called in TableSetupColumn() when initializing and in TableLoadSettings() for defaults before applying stored settings.
@@ -2568,8 +2573,9 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 }
 
 // This function reorder draw channels based on matching clip rectangle, to facilitate merging them. Called by EndTable().
-// For simplicity we call it TableMergeDrawChannels() but in fact it only reorder channels + overwrite ClipRect,
-// actual merging is done by table->DrawSplitter.Merge() which is called right after TableMergeDrawChannels().
+// For simplicity we call it TableMergeDrawChannels() but in fact it only overwrite ClipRect + output a channel order into
+// g.DrawChannelsTempMergeOrder[] (left empty when no reordering is needed), actual merging is done by table->DrawSplitter.Merge()
+// which is called right after TableMergeDrawChannels() with that order.
 //
 // Columns where the contents didn't stray off their local clip rectangle can be merged. To achieve
 // this we merge their clip rect and make them contiguous in the channel list, so they can be merged
@@ -2691,13 +2697,15 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
         }
 #endif
 
-    // 2. Rewrite channel list in our preferred order
+    // 2. Output channel list in our preferred order
     if (merge_group_mask != 0)
     {
         // We skip channel 0 (Bg0/Bg1) and 1 (Bg2 frozen) from the shuffling since they won't move - see channels allocation in TableSetupDrawChannels().
         const int LEADING_DRAW_CHANNELS = 2;
-        g.DrawChannelsTempMergeBuffer.resize(splitter->_Count - LEADING_DRAW_CHANNELS); // Use shared temporary storage so the allocation gets amortized
-        ImDrawChannel* dst_tmp = g.DrawChannelsTempMergeBuffer.Data;
+        g.DrawChannelsTempMergeOrder.resize(splitter->_Count); // Use shared temporary storage so the allocation gets amortized
+        int* dst_order = g.DrawChannelsTempMergeOrder.Data;
+        for (int n = 0; n < LEADING_DRAW_CHANNELS; n++)
+            *dst_order++ = n;
         ImBitArraySetBitRange(remaining_mask, LEADING_DRAW_CHANNELS, splitter->_Count);
         ImBitArrayClearBit(remaining_mask, table->Bg2DrawChannelUnfrozen);
         IM_ASSERT(has_freeze_v == false || table->Bg2DrawChannelUnfrozen != TABLE_DRAW_CHANNEL_BG2_FROZEN);
@@ -2743,13 +2751,13 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
                     ImDrawChannel* channel = &splitter->_Channels[n];
                     IM_ASSERT(channel->_CmdBuffer.Size == 1 && merge_clip_rect.Contains(ImRect(channel->_CmdBuffer[0].ClipRect)));
                     channel->_CmdBuffer[0].ClipRect = merge_clip_rect.ToVec4();
-                    memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
+                    *dst_order++ = n;
                 }
             }
 
             // Make sure Bg2DrawChannelUnfrozen appears in the middle of our groups (whereas Bg0/Bg1 and Bg2 frozen are fixed to 0 and 1)
             if (merge_group_n == 1 && has_freeze_v)
-                memcpy(dst_tmp++, &splitter->_Channels[table->Bg2DrawChannelUnfrozen], sizeof(ImDrawChannel));
+                *dst_order++ = table->Bg2DrawChannelUnfrozen;
         }
 
         // Append unmergeable channels that we didn't reorder at the end of the list
@@ -2757,12 +2765,10 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
         {
             if (!IM_BITARRAY_TESTBIT(remaining_mask, n))
                 continue;
-            ImDrawChannel* channel = &splitter->_Channels[n];
-            memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
+            *dst_order++ = n;
             remaining_count--;
         }
-        IM_ASSERT(dst_tmp == g.DrawChannelsTempMergeBuffer.Data + g.DrawChannelsTempMergeBuffer.Size);
-        memcpy(splitter->_Channels.Data + LEADING_DRAW_CHANNELS, g.DrawChannelsTempMergeBuffer.Data, (splitter->_Count - LEADING_DRAW_CHANNELS) * sizeof(ImDrawChannel));
+        IM_ASSERT(dst_order == g.DrawChannelsTempMergeOrder.Data + g.DrawChannelsTempMergeOrder.Size);
     }
 }
 